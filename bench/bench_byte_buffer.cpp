@@ -0,0 +1,170 @@
+#include "bench_harness.h"
+#include "byte_buffer.h"
+
+#include <cstdint>
+#include <string>
+
+/**
+ * @file bench_byte_buffer.cpp
+ * @brief ByteBuffer read/write throughput for every width and byte order.
+ *
+ * One operation is one typed read or write. The buffer is small enough to stay
+ * in L1, and the cursor is reset whenever it runs out, so the numbers measure
+ * the accessor itself rather than memory bandwidth.
+ */
+
+namespace antBench {
+namespace {
+
+using antBuffers::ByteBuffer;
+
+constexpr size_t bufferBytes = 4096;
+
+template<typename V>
+Benchmark writeBench(const char *name, bool (ByteBuffer::*write)(V), size_t bytes = sizeof(V)) {
+    return {std::string("ByteBuffer/") + name, bytes, [write](uint64_t ops) {
+        static uint8_t storage[bufferBytes];
+        ByteBuffer bb(storage, sizeof(storage));
+        V v = V(0x1234567u);
+        for (uint64_t i = 0; i < ops; ++i) {
+            if (!(bb.*write)(v)) {
+                bb.resetWrite();
+                (bb.*write)(v);
+            }
+            v = V(v + 1);
+        }
+        doNotOptimize(storage);
+    }};
+}
+
+template<typename V>
+Benchmark readBench(const char *name, bool (ByteBuffer::*read)(V &), size_t bytes = sizeof(V)) {
+    return {std::string("ByteBuffer/") + name, bytes, [read](uint64_t ops) {
+        static uint8_t storage[bufferBytes];
+        ByteBuffer bb(storage, sizeof(storage));
+        for (size_t i = 0; i < bufferBytes; ++i) bb.writeUInt8(uint8_t(i * 31));
+        V v{};
+        V acc{};
+        for (uint64_t i = 0; i < ops; ++i) {
+            if (!(bb.*read)(v)) {
+                bb.resetRead();
+                (bb.*read)(v);
+            }
+            acc = V(acc + v);
+        }
+        doNotOptimize(acc);
+    }};
+}
+
+/** @brief One operation is one array call of @p count values. */
+template<typename V>
+Benchmark arrayBench(const char *name, size_t count, bool (ByteBuffer::*write)(const V *, size_t),
+                     bool (ByteBuffer::*read)(V *, size_t)) {
+    return {std::string("ByteBuffer/") + name + "/" + std::to_string(count), count * sizeof(V),
+            [=](uint64_t ops) {
+        static uint8_t storage[bufferBytes];
+        static V values[bufferBytes / sizeof(V)];
+        ByteBuffer bb(storage, count * sizeof(V));
+        for (uint64_t i = 0; i < ops; ++i) {
+            values[0] = V(i);
+            bb.resetWrite();
+            bb.resetRead();
+            (bb.*write)(values, count);
+            (bb.*read)(values, count);
+        }
+        doNotOptimize(values);
+    }};
+}
+
+/**
+ * @brief One operation is one readVarUIntArray() call over @p count varints
+ *        below @p limit (128 = all one byte, 16384 = up to two bytes).
+ */
+Benchmark varUIntArrayBench(size_t count, uint32_t limit) {
+    auto value = [limit](size_t i) { return uint32_t((i * 2654435761u) >> 8) % limit; };
+    size_t bytes = 0;
+    for (size_t i = 0; i < count; ++i) bytes += antBuffers::detail::varUIntSize(value(i));
+    return {"ByteBuffer/readVarUIntArray/" + std::to_string(count) + "/<" + std::to_string(limit), bytes,
+            [=](uint64_t ops) {
+        static uint8_t storage[bufferBytes];
+        static uint32_t values[bufferBytes / 4];
+        ByteBuffer bb(storage, sizeof(storage));
+        for (size_t i = 0; i < count; ++i) bb.writeVarUInt(value(i));
+        for (uint64_t i = 0; i < ops; ++i) {
+            bb.resetRead();
+            bb.readVarUIntArray(values, count);
+        }
+        doNotOptimize(values);
+    }};
+}
+
+/**
+ * @brief One operation is one 12-field, 41-byte record, encoded either with
+ *        checked per-field writes or with one beginRecord() reservation.
+ */
+Benchmark recordBench(bool fluent) {
+    return {std::string("ByteBuffer/record/") + (fluent ? "beginRecord" : "checked"), 41, [fluent](uint64_t ops) {
+        static uint8_t storage[bufferBytes];
+        ByteBuffer bb(storage, sizeof(storage));
+        uint32_t x = 1;
+        for (uint64_t i = 0; i < ops; ++i) {
+            x += 0x9E3779B9u;
+            bool ok;
+            if (fluent) {
+                antBuffers::RecordWriter w = bb.beginRecord(41);
+                w.putUInt8(uint8_t(x)).putUInt8(2).putUInt16BE(uint16_t(x)).putUInt32LE(x)
+                 .putUInt32LE(x ^ 1).putUInt64LE(uint64_t(x) << 20).putInt16LE(int16_t(x))
+                 .putInt32BE(int32_t(x)).putFloat32LE(float(x)).putFloat64LE(double(x))
+                 .putUInt8(3).putUInt16LE(4);
+                ok = bb.endRecord(w);
+            } else {
+                ok = bb.writeUInt8(uint8_t(x)) && bb.writeUInt8(2) && bb.writeUInt16BE(uint16_t(x))
+                  && bb.writeUInt32LE(x) && bb.writeUInt32LE(x ^ 1) && bb.writeUInt64LE(uint64_t(x) << 20)
+                  && bb.writeInt16LE(int16_t(x)) && bb.writeInt32BE(int32_t(x)) && bb.writeFloat32LE(float(x))
+                  && bb.writeFloat64LE(double(x)) && bb.writeUInt8(3) && bb.writeUInt16LE(4);
+            }
+            if (!ok || bb.writeRemaining() < 41) bb.resetWrite();
+        }
+        doNotOptimize(storage);
+    }};
+}
+
+} // namespace
+
+void registerByteBuffer(std::vector<Benchmark> &out) {
+    out.push_back(writeBench<uint8_t>("writeUInt8", &ByteBuffer::writeUInt8));
+    out.push_back(writeBench<uint16_t>("writeUInt16LE", &ByteBuffer::writeUInt16LE));
+    out.push_back(writeBench<uint16_t>("writeUInt16BE", &ByteBuffer::writeUInt16BE));
+    out.push_back(writeBench<uint32_t>("writeUInt32LE", &ByteBuffer::writeUInt32LE));
+    out.push_back(writeBench<uint32_t>("writeUInt32BE", &ByteBuffer::writeUInt32BE));
+    out.push_back(writeBench<uint64_t>("writeUInt64BE", &ByteBuffer::writeUInt64BE));
+    out.push_back(writeBench<double>("writeFloat64BE", &ByteBuffer::writeFloat64BE));
+    out.push_back(writeBench<float>("writeFloat16LE", &ByteBuffer::writeFloat16LE, 2));
+
+    out.push_back(readBench<uint8_t>("readUInt8", &ByteBuffer::readUInt8));
+    out.push_back(readBench<uint16_t>("readUInt16LE", &ByteBuffer::readUInt16LE));
+    out.push_back(readBench<uint16_t>("readUInt16BE", &ByteBuffer::readUInt16BE));
+    out.push_back(readBench<uint32_t>("readUInt32LE", &ByteBuffer::readUInt32LE));
+    out.push_back(readBench<uint32_t>("readUInt32BE", &ByteBuffer::readUInt32BE));
+    out.push_back(readBench<uint64_t>("readUInt64BE", &ByteBuffer::readUInt64BE));
+    out.push_back(readBench<double>("readFloat64BE", &ByteBuffer::readFloat64BE));
+    out.push_back(readBench<float>("readFloat16LE", &ByteBuffer::readFloat16LE, 2));
+
+    out.push_back(writeBench<uint64_t>("writeVarUInt", &ByteBuffer::writeVarUInt, 4));
+    out.push_back(varUIntArrayBench(1024, 128));
+    out.push_back(varUIntArrayBench(1024, 16384));
+
+    out.push_back(recordBench(false));
+    out.push_back(recordBench(true));
+
+    out.push_back(arrayBench<uint8_t>("bytes", 200, &ByteBuffer::writeBytes, &ByteBuffer::readBytes));
+    out.push_back(arrayBench<uint16_t>("uint16ArrayLE", 256, &ByteBuffer::writeUInt16ArrayLE,
+                                       &ByteBuffer::readUInt16ArrayLE));
+    out.push_back(arrayBench<uint16_t>("uint16ArrayBE", 256, &ByteBuffer::writeUInt16ArrayBE,
+                                       &ByteBuffer::readUInt16ArrayBE));
+    out.push_back(arrayBench<uint32_t>("uint32ArrayLE", 256, &ByteBuffer::writeUInt32ArrayLE,
+                                       &ByteBuffer::readUInt32ArrayLE));
+    out.push_back(arrayBench<uint32_t>("uint32ArrayBE", 256, &ByteBuffer::writeUInt32ArrayBE,
+                                       &ByteBuffer::readUInt32ArrayBE));
+}
+} // namespace antBench
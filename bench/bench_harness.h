@@ -0,0 +1,134 @@
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace antBench {
+/**
+ * @file bench_harness.h
+ * @brief Minimal micro-benchmark harness for ant_buffer_bench.
+ *
+ * Each benchmark is a function that performs a given number of operations.
+ * The harness warms it up, calibrates a batch size that takes roughly
+ * Options::sampleMs, then times several batches and reports the median, so a
+ * single preempted batch does not skew the result. Every sample is kept for
+ * the JSON output, where a regression gate can compare distributions.
+ */
+
+/**
+ * @brief Keep @p v alive so the compiler cannot delete the work producing it.
+ */
+template<typename T>
+inline void doNotOptimize(const T &v) {
+#if defined(__GNUC__) || defined(__clang__)
+    __asm__ __volatile__("" : : "r,m"(v) : "memory");
+#else
+    const volatile T sink = v;
+    (void)sink;
+#endif
+}
+
+/**
+ * @brief Force pending stores to be treated as observable.
+ */
+inline void clobberMemory() {
+#if defined(__GNUC__) || defined(__clang__)
+    __asm__ __volatile__("" : : : "memory");
+#endif
+}
+
+/** @brief Body of a benchmark: perform @p ops operations. */
+using BenchFn = std::function<void(uint64_t ops)>;
+
+/** @brief A registered benchmark. */
+struct Benchmark {
+    std::string name;        /**< "Group/case", used for --filter and in reports. */
+    size_t      bytesPerOp;  /**< Payload bytes moved per operation (0 if not meaningful). */
+    BenchFn     fn;          /**< Body. */
+};
+
+/** @brief Run-wide settings, filled from the command line. */
+struct Options {
+    std::string filter;         /**< Only run benchmarks whose name contains this. */
+    std::string jsonPath;       /**< Write JSON results here ("-" for stdout, empty for none). */
+    int         cpu = -1;       /**< CPU to pin to, or -1 to leave affinity alone. */
+    double      warmupMs = 50;  /**< Untimed run before calibration. */
+    double      sampleMs = 20;  /**< Target duration of one timed batch. */
+    int         repetitions = 15; /**< Timed batches per benchmark. */
+};
+
+/** @brief Measurements for one benchmark. */
+struct Result {
+    std::string         name;        /**< Benchmark name. */
+    size_t              bytesPerOp;  /**< Copied from the Benchmark. */
+    uint64_t            opsPerSample; /**< Operations in each timed batch. */
+    std::vector<double> samples;     /**< ns/op of each batch, in run order. */
+    double              medianNs;    /**< Median of samples. */
+    double              minNs;       /**< Fastest batch. */
+    double              maxNs;       /**< Slowest batch. */
+
+    /** @brief Operations per second at the median. */
+    double opsPerSec() const { return medianNs > 0 ? 1e9 / medianNs : 0; }
+
+    /** @brief Payload bytes per second at the median. */
+    double bytesPerSec() const { return opsPerSec() * double(bytesPerOp); }
+};
+
+/** @brief Wall time of one call to @p fn with @p ops operations, in ns. */
+inline double timeBatch(const BenchFn &fn, uint64_t ops) {
+    const auto start = std::chrono::steady_clock::now();
+    fn(ops);
+    clobberMemory();
+    const auto end = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::nano>(end - start).count();
+}
+
+/**
+ * @brief Warm up, calibrate and time one benchmark.
+ */
+inline Result run(const Benchmark &b, const Options &opt) {
+    // Warmup: grow the batch until warmupMs has been spent in the body.
+    uint64_t ops = 1;
+    double spent = 0;
+    while (spent < opt.warmupMs * 1e6) {
+        spent += timeBatch(b.fn, ops);
+        if (ops < (uint64_t(1) << 40)) ops *= 2;
+    }
+
+    // Calibrate: find a batch size that takes about sampleMs.
+    ops = 1;
+    for (;;) {
+        const double ns = timeBatch(b.fn, ops);
+        if (ns >= opt.sampleMs * 1e6 / 4 || ops >= (uint64_t(1) << 40)) {
+            const double perOp = ns / double(ops);
+            ops = std::max<uint64_t>(1, uint64_t(opt.sampleMs * 1e6 / perOp));
+            break;
+        }
+        ops *= 4;
+    }
+
+    Result r{b.name, b.bytesPerOp, ops, {}, 0, 0, 0};
+    for (int i = 0; i < opt.repetitions; ++i) {
+        r.samples.push_back(timeBatch(b.fn, ops) / double(ops));
+    }
+    std::vector<double> sorted = r.samples;
+    std::sort(sorted.begin(), sorted.end());
+    const size_t n = sorted.size();
+    r.medianNs = n % 2 ? sorted[n / 2] : (sorted[n / 2 - 1] + sorted[n / 2]) / 2;
+    r.minNs = sorted.front();
+    r.maxNs = sorted.back();
+    return r;
+}
+
+//-------------------------------------------------------------------------
+// Registration, one function per benchmarked header
+//-------------------------------------------------------------------------
+void registerByteBuffer(std::vector<Benchmark> &out);
+void registerMessageBuffer(std::vector<Benchmark> &out);
+void registerRingBuffer(std::vector<Benchmark> &out);
+} // namespace antBench
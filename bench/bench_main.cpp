@@ -0,0 +1,142 @@
+#include "bench_harness.h"
+#include "ring_detail.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+#include <string>
+#include <vector>
+
+/**
+ * @file bench_main.cpp
+ * @brief Command-line driver for ant_buffer_bench.
+ *
+ * Usage: ant_buffer_bench [--filter=SUBSTR] [--json=PATH|-] [--cpu=N]
+ *                         [--warmup-ms=MS] [--sample-ms=MS] [--repetitions=N]
+ *                         [--list]
+ *
+ * Build with optimizations (the target always uses -O2, independent of
+ * CODE_COVERAGE) and pin to an otherwise idle core for stable numbers.
+ */
+
+namespace {
+
+bool startsWith(const char *arg, const char *prefix, const char **value) {
+    const size_t n = std::strlen(prefix);
+    if (std::strncmp(arg, prefix, n) != 0) return false;
+    *value = arg + n;
+    return true;
+}
+
+void usage(const char *argv0) {
+    std::fprintf(stderr,
+                 "usage: %s [--filter=SUBSTR] [--json=PATH|-] [--cpu=N]\n"
+                 "          [--warmup-ms=MS] [--sample-ms=MS] [--repetitions=N] [--list]\n",
+                 argv0);
+}
+
+/** @brief Write @p s as a JSON string literal. */
+void jsonString(std::FILE *f, const std::string &s) {
+    std::fputc('"', f);
+    for (char c : s) {
+        if (c == '"' || c == '\\') std::fputc('\\', f);
+        std::fputc(c, f);
+    }
+    std::fputc('"', f);
+}
+
+bool writeJson(const std::string &path, const antBench::Options &opt,
+               const std::vector<antBench::Result> &results) {
+    std::FILE *f = (path == "-") ? stdout : std::fopen(path.c_str(), "w");
+    if (!f) return false;
+
+    std::fprintf(f, "{\n  \"context\": {\n");
+    std::fprintf(f, "    \"timestamp\": %lld,\n", (long long)std::time(nullptr));
+#if defined(__clang__)
+    std::fprintf(f, "    \"compiler\": \"clang %d.%d\",\n", __clang_major__, __clang_minor__);
+#elif defined(__GNUC__)
+    std::fprintf(f, "    \"compiler\": \"gcc %d.%d\",\n", __GNUC__, __GNUC_MINOR__);
+#endif
+    std::fprintf(f, "    \"cpu\": %d,\n", opt.cpu);
+    std::fprintf(f, "    \"warmup_ms\": %g,\n", opt.warmupMs);
+    std::fprintf(f, "    \"sample_ms\": %g,\n", opt.sampleMs);
+    std::fprintf(f, "    \"repetitions\": %d\n  },\n", opt.repetitions);
+
+    std::fprintf(f, "  \"benchmarks\": [\n");
+    for (size_t i = 0; i < results.size(); ++i) {
+        const auto &r = results[i];
+        std::fprintf(f, "    {\"name\": ");
+        jsonString(f, r.name);
+        std::fprintf(f, ", \"ns_per_op\": %.4f, \"ops_per_sec\": %.1f, \"bytes_per_sec\": %.1f,",
+                     r.medianNs, r.opsPerSec(), r.bytesPerSec());
+        std::fprintf(f, " \"min_ns\": %.4f, \"max_ns\": %.4f, \"bytes_per_op\": %zu,"
+                        " \"ops_per_sample\": %llu,\n     \"samples_ns\": [",
+                     r.minNs, r.maxNs, r.bytesPerOp, (unsigned long long)r.opsPerSample);
+        for (size_t k = 0; k < r.samples.size(); ++k) {
+            std::fprintf(f, "%s%.4f", k ? ", " : "", r.samples[k]);
+        }
+        std::fprintf(f, "]}%s\n", i + 1 < results.size() ? "," : "");
+    }
+    std::fprintf(f, "  ]\n}\n");
+    if (f != stdout) std::fclose(f);
+    return true;
+}
+
+} // namespace
+
+int main(int argc, char **argv) {
+    antBench::Options opt;
+    bool list = false;
+    for (int i = 1; i < argc; ++i) {
+        const char *v = nullptr;
+        if (startsWith(argv[i], "--filter=", &v)) opt.filter = v;
+        else if (startsWith(argv[i], "--json=", &v)) opt.jsonPath = v;
+        else if (startsWith(argv[i], "--cpu=", &v)) opt.cpu = std::atoi(v);
+        else if (startsWith(argv[i], "--warmup-ms=", &v)) opt.warmupMs = std::atof(v);
+        else if (startsWith(argv[i], "--sample-ms=", &v)) opt.sampleMs = std::atof(v);
+        else if (startsWith(argv[i], "--repetitions=", &v)) opt.repetitions = std::atoi(v);
+        else if (std::strcmp(argv[i], "--list") == 0) list = true;
+        else {
+            usage(argv[0]);
+            return 2;
+        }
+    }
+    if (opt.repetitions < 1 || opt.sampleMs <= 0 || opt.warmupMs < 0) {
+        usage(argv[0]);
+        return 2;
+    }
+
+    std::vector<antBench::Benchmark> all;
+    antBench::registerByteBuffer(all);
+    antBench::registerMessageBuffer(all);
+    antBench::registerRingBuffer(all);
+
+    if (list) {
+        for (const auto &b : all) std::printf("%s\n", b.name.c_str());
+        return 0;
+    }
+
+    if (opt.cpu >= 0 && !antBuffers::detail::pinCurrentThread(size_t(opt.cpu))) {
+        std::fprintf(stderr, "warning: could not pin to CPU %d\n", opt.cpu);
+    }
+
+    // With JSON on stdout, keep the human-readable table on stderr.
+    std::FILE *table = (opt.jsonPath == "-") ? stderr : stdout;
+    std::fprintf(table, "%-44s %12s %14s %14s\n", "benchmark", "ns/op", "ops/s", "MB/s");
+
+    std::vector<antBench::Result> results;
+    for (const auto &b : all) {
+        if (!opt.filter.empty() && b.name.find(opt.filter) == std::string::npos) continue;
+        results.push_back(antBench::run(b, opt));
+        const auto &r = results.back();
+        std::fprintf(table, "%-44s %12.3f %14.0f %14.1f\n",
+                     r.name.c_str(), r.medianNs, r.opsPerSec(), r.bytesPerSec() / 1e6);
+    }
+
+    if (!opt.jsonPath.empty() && !writeJson(opt.jsonPath, opt, results)) {
+        std::fprintf(stderr, "error: could not write %s\n", opt.jsonPath.c_str());
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,62 @@
+#include "bench_harness.h"
+#include "message_buffer.h"
+
+#include <cstdint>
+#include <string>
+
+/**
+ * @file bench_message_buffer.cpp
+ * @brief MessageBuffer encode/decode throughput.
+ *
+ * One operation is one complete frame: header plus a payload of the given
+ * size written byte by byte (encode), or parsed and read back (decode).
+ */
+
+namespace antBench {
+namespace {
+
+using antBuffers::MessageBuffer;
+
+Benchmark encodeBench(size_t payload) {
+    return {"MessageBuffer/encode/" + std::to_string(payload), payload + 2, [payload](uint64_t ops) {
+        static uint8_t storage[258];
+        MessageBuffer mb(storage, sizeof(storage));
+        for (uint64_t i = 0; i < ops; ++i) {
+            mb.beginMessage(uint8_t(i));
+            for (size_t k = 0; k < payload; ++k) mb.writeByte(uint8_t(k + i));
+            mb.finalizeMessage();
+            doNotOptimize(mb.size());
+        }
+        doNotOptimize(storage);
+    }};
+}
+
+Benchmark decodeBench(size_t payload) {
+    return {"MessageBuffer/decode/" + std::to_string(payload), payload + 2, [payload](uint64_t ops) {
+        static uint8_t storage[258];
+        MessageBuffer mb(storage, sizeof(storage));
+        mb.beginMessage(7);
+        for (size_t k = 0; k < payload; ++k) mb.writeByte(uint8_t(k));
+        mb.finalizeMessage();
+        const size_t frame = mb.size();
+
+        uint8_t acc = 0;
+        for (uint64_t i = 0; i < ops; ++i) {
+            mb.beginRead(frame);
+            acc ^= mb.messageType();
+            uint8_t b;
+            while (mb.readRemaining() && mb.readByte(b)) acc ^= b;
+        }
+        doNotOptimize(acc);
+    }};
+}
+
+} // namespace
+
+void registerMessageBuffer(std::vector<Benchmark> &out) {
+    for (size_t payload : {8, 32, 200}) {
+        out.push_back(encodeBench(payload));
+        out.push_back(decodeBench(payload));
+    }
+}
+} // namespace antBench
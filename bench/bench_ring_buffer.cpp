@@ -0,0 +1,82 @@
+#include "bench_harness.h"
+#include "ring_buffer.h"
+
+#include <cstdint>
+#include <memory>
+#include <string>
+
+/**
+ * @file bench_ring_buffer.cpp
+ * @brief RingBuffer push/pop throughput across element sizes and capacities.
+ *
+ * The ring is kept half full so every operation crosses the wrap point
+ * regularly. One operation is one push followed by one pop (or one element of
+ * a 32-element push_bulk/pop_bulk pair). Capacities include a non-power of two
+ * to cover the compare-and-wrap counter path as well as the masked one.
+ */
+
+namespace antBench {
+namespace {
+
+using antBuffers::RingBuffer;
+
+/** @brief Trivially copyable element of @p Size bytes. */
+template<size_t Size>
+struct Payload {
+    uint8_t bytes[Size];
+};
+
+template<size_t Size, size_t N>
+std::string label(const char *op) {
+    return "RingBuffer/" + std::string(op) + "/" + std::to_string(Size) + "B/" + std::to_string(N);
+}
+
+template<size_t Size, size_t N>
+void addPushPop(std::vector<Benchmark> &out) {
+    out.push_back({label<Size, N>("push_pop"), Size, [](uint64_t ops) {
+        auto rb = std::make_unique<RingBuffer<Payload<Size>, N>>();
+        Payload<Size> in{}, got{};
+        for (size_t i = 0; i < N / 2; ++i) rb->push(in);
+        for (uint64_t i = 0; i < ops; ++i) {
+            in.bytes[0] = uint8_t(i);
+            rb->push(in);
+            rb->pop(got);
+            doNotOptimize(got);
+        }
+    }});
+}
+
+template<size_t Size, size_t N>
+void addBulk(std::vector<Benchmark> &out) {
+    constexpr size_t batch = 32;
+    static_assert(N >= 2 * batch, "bulk benchmark needs room for two batches");
+    out.push_back({label<Size, N>("bulk32"), Size, [](uint64_t ops) {
+        auto rb = std::make_unique<RingBuffer<Payload<Size>, N>>();
+        Payload<Size> in[batch]{}, got[batch];
+        for (size_t i = 0; i < N / 2; ++i) rb->push(in[0]);
+        for (uint64_t i = 0; i < ops; i += batch) {
+            in[0].bytes[0] = uint8_t(i);
+            rb->push_bulk(in, batch);
+            rb->pop_bulk(got, batch);
+            doNotOptimize(got);
+        }
+    }});
+}
+
+template<size_t Size>
+void addSize(std::vector<Benchmark> &out) {
+    addPushPop<Size, 64>(out);
+    addPushPop<Size, 1000>(out);
+    addPushPop<Size, 4096>(out);
+    addBulk<Size, 64>(out);
+    addBulk<Size, 4096>(out);
+}
+
+} // namespace
+
+void registerRingBuffer(std::vector<Benchmark> &out) {
+    addSize<4>(out);
+    addSize<16>(out);
+    addSize<64>(out);
+}
+} // namespace antBench
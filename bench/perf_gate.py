@@ -0,0 +1,211 @@
+#!/usr/bin/env python3
+"""Performance regression gate for ant_buffer_bench.
+
+Runs the benchmark suite several times, pools the per-batch samples of each
+benchmark, and compares them against a stored baseline with a one-sided
+Mann-Whitney U test. A benchmark regresses when its median ns/op is more than
+--threshold percent slower than the baseline *and* the slowdown is
+significant at --alpha, so ordinary run-to-run noise does not fail the gate.
+
+Standard library only; runs offline.
+
+    perf_gate.py run      --bench BIN --out run.json [--runs 5] [-- bench args]
+    perf_gate.py compare  BASELINE.json CANDIDATE.json [--threshold 5] [--alpha 0.01]
+    perf_gate.py gate     --bench BIN --baseline FILE [--update-baseline] [...]
+
+Exit status: 0 = no regression, 1 = regression found, 2 = usage or I/O error.
+"""
+
+import argparse
+import json
+import math
+import os
+import subprocess
+import sys
+import tempfile
+
+
+def run_suite(bench, runs, bench_args):
+    """Run the benchmark binary `runs` times and pool samples by name."""
+    pooled = {}
+    order = []
+    context = None
+    for i in range(runs):
+        fd, path = tempfile.mkstemp(suffix=".json")
+        os.close(fd)
+        try:
+            cmd = [bench, "--json=" + path] + list(bench_args)
+            print("[%d/%d] %s" % (i + 1, runs, " ".join(cmd)), file=sys.stderr)
+            subprocess.run(cmd, check=True, stdout=subprocess.DEVNULL)
+            with open(path) as f:
+                data = json.load(f)
+        finally:
+            os.unlink(path)
+        context = data.get("context", context)
+        for b in data["benchmarks"]:
+            if b["name"] not in pooled:
+                pooled[b["name"]] = dict(b, samples_ns=[])
+                order.append(b["name"])
+            pooled[b["name"]]["samples_ns"].extend(b["samples_ns"])
+
+    benchmarks = []
+    for name in order:
+        b = pooled[name]
+        b["ns_per_op"] = median(b["samples_ns"])
+        benchmarks.append(b)
+    return {"context": dict(context or {}, runs=runs), "benchmarks": benchmarks}
+
+
+def load(path):
+    with open(path) as f:
+        data = json.load(f)
+    return {b["name"]: b for b in data["benchmarks"]}
+
+
+def median(xs):
+    s = sorted(xs)
+    n = len(s)
+    if n == 0:
+        return float("nan")
+    return s[n // 2] if n % 2 else (s[n // 2 - 1] + s[n // 2]) / 2.0
+
+
+def mann_whitney_greater(a, b):
+    """One-sided p-value that samples `a` tend to be larger than `b`.
+
+    Uses the normal approximation with tie correction and continuity
+    correction, which is adequate for the 15+ samples per side the bench
+    produces.
+    """
+    n1, n2 = len(a), len(b)
+    if n1 == 0 or n2 == 0:
+        return 1.0
+    combined = sorted([(v, 0) for v in a] + [(v, 1) for v in b])
+    ranks = [0.0] * len(combined)
+    tie_term = 0.0
+    i = 0
+    while i < len(combined):
+        j = i
+        while j + 1 < len(combined) and combined[j + 1][0] == combined[i][0]:
+            j += 1
+        rank = (i + j) / 2.0 + 1.0
+        for k in range(i, j + 1):
+            ranks[k] = rank
+        t = j - i + 1
+        tie_term += t ** 3 - t
+        i = j + 1
+
+    r1 = sum(r for r, (_, group) in zip(ranks, combined) if group == 0)
+    u1 = r1 - n1 * (n1 + 1) / 2.0
+    n = n1 + n2
+    mean = n1 * n2 / 2.0
+    var = n1 * n2 / 12.0 * ((n + 1) - tie_term / (n * (n - 1)))
+    if var <= 0:
+        return 1.0
+    z = (u1 - mean - 0.5) / math.sqrt(var)
+    return 0.5 * math.erfc(z / math.sqrt(2.0))
+
+
+def compare(baseline, candidate, threshold, alpha):
+    """Return (report lines, regressed names)."""
+    lines = []
+    regressed = []
+    header = "%-44s %11s %11s %8s %9s  %s" % ("benchmark", "base ns", "new ns", "change", "p", "verdict")
+    lines.append(header)
+    lines.append("-" * len(header))
+    for name, cand in candidate.items():
+        base = baseline.get(name)
+        if base is None:
+            lines.append("%-44s %11s %11.3f %8s %9s  new" % (name, "-", median(cand["samples_ns"]), "", ""))
+            continue
+        b_med = median(base["samples_ns"])
+        c_med = median(cand["samples_ns"])
+        change = (c_med / b_med - 1.0) * 100.0 if b_med > 0 else 0.0
+        p = mann_whitney_greater(cand["samples_ns"], base["samples_ns"])
+        if change > threshold and p < alpha:
+            verdict = "REGRESSION"
+            regressed.append(name)
+        elif change < -threshold and mann_whitney_greater(base["samples_ns"], cand["samples_ns"]) < alpha:
+            verdict = "faster"
+        else:
+            verdict = "ok"
+        lines.append("%-44s %11.3f %11.3f %+7.1f%% %9.2g  %s" % (name, b_med, c_med, change, p, verdict))
+    for name in baseline:
+        if name not in candidate:
+            lines.append("%-44s %11.3f %11s %8s %9s  missing" % (name, median(baseline[name]["samples_ns"]), "-", "", ""))
+    return lines, regressed
+
+
+def report(baseline, candidate, args):
+    lines, regressed = compare(baseline, candidate, args.threshold, args.alpha)
+    print("\n".join(lines))
+    print()
+    if regressed:
+        print("FAIL: %d benchmark(s) slower by more than %.1f%% (p < %g):" % (len(regressed), args.threshold, args.alpha))
+        for name in regressed:
+            print("  " + name)
+        return 1
+    print("PASS: no regression beyond %.1f%% (p < %g)" % (args.threshold, args.alpha))
+    return 0
+
+
+def write(path, data):
+    with open(path, "w") as f:
+        json.dump(data, f, indent=1)
+        f.write("\n")
+
+
+def main(argv):
+    parser = argparse.ArgumentParser(description=__doc__.split("\n\n")[0])
+    sub = parser.add_subparsers(dest="cmd", required=True)
+
+    def add_run_args(p):
+        p.add_argument("--bench", required=True, help="path to ant_buffer_bench")
+        p.add_argument("--runs", type=int, default=5, help="suite runs to pool (default 5)")
+        p.add_argument("bench_args", nargs="*", help="extra ant_buffer_bench arguments, after --")
+
+    def add_compare_args(p):
+        p.add_argument("--threshold", type=float, default=5.0, help="allowed slowdown in percent (default 5)")
+        p.add_argument("--alpha", type=float, default=0.01, help="significance level (default 0.01)")
+
+    p_run = sub.add_parser("run", help="run the suite and store pooled results")
+    add_run_args(p_run)
+    p_run.add_argument("--out", required=True)
+
+    p_cmp = sub.add_parser("compare", help="compare two result files")
+    p_cmp.add_argument("baseline")
+    p_cmp.add_argument("candidate")
+    add_compare_args(p_cmp)
+
+    p_gate = sub.add_parser("gate", help="run the suite and compare against a baseline")
+    add_run_args(p_gate)
+    add_compare_args(p_gate)
+    p_gate.add_argument("--baseline", required=True)
+    p_gate.add_argument("--out", help="also store this run's pooled results")
+    p_gate.add_argument("--update-baseline", action="store_true",
+                        help="replace the baseline with this run instead of comparing")
+
+    args = parser.parse_args(argv)
+    try:
+        if args.cmd == "run":
+            write(args.out, run_suite(args.bench, args.runs, args.bench_args))
+            return 0
+        if args.cmd == "compare":
+            return report(load(args.baseline), load(args.candidate), args)
+
+        result = run_suite(args.bench, args.runs, args.bench_args)
+        if args.out:
+            write(args.out, result)
+        if args.update_baseline or not os.path.exists(args.baseline):
+            write(args.baseline, result)
+            print("baseline written to %s" % args.baseline)
+            return 0
+        candidate = {b["name"]: b for b in result["benchmarks"]}
+        return report(load(args.baseline), candidate, args)
+    except (OSError, ValueError, KeyError, subprocess.CalledProcessError) as e:
+        print("error: %s" % e, file=sys.stderr)
+        return 2
+
+
+if __name__ == "__main__":
+    sys.exit(main(sys.argv[1:]))
@@ -2,7 +2,17 @@
 
 #include "byte_buffer.h"
 #include "message_buffer.h"
+#include "byte_ring.h"
 #include "ring_buffer.h"
+#include "spsc_ring_buffer.h"
+#include "mpmc_ring_buffer.h"
+#include "multicast_ring.h"
+#include "sharded_ring_pool.h"
+#include "windowed_ring.h"
+#include "blocking_ring.h"
+#include "async_ring.h"
+#include "mirrored_byte_ring.h"
+#include "shm_ring.h"
 
 namespace antBuffers {
 
@@ -16,6 +26,16 @@ namespace antBuffers {
         return ByteBuffer(buffer, capacity);
     }
 
+    /**
+     * @brief Factory for a ByteRing over external storage.
+     * @param buffer   Pointer to the raw byte array.
+     * @param capacity Total size of the array in bytes.
+     * @return ByteRing instance operating over the provided buffer.
+     */
+    inline ByteRing make_byte_ring(uint8_t* buffer, size_t capacity) {
+        return ByteRing(buffer, capacity);
+    }
+
     /**
      * @brief Factory for a MessageBuffer over external storage.
      * @param buffer   Pointer to the raw byte array.
@@ -26,7 +46,20 @@ namespace antBuffers {
         return MessageBuffer(buffer, capacity);
     }
 
+    /**
+     * @brief Factory for a RingBufferView over external storage.
+     * @param storage     Memory for at least @p maxElements objects of type T.
+     * @param maxElements Number of elements the memory can hold; the ring uses
+     *                    the largest power of two that fits.
+     * @return RingBufferView instance operating over the provided storage.
+     */
+    template<typename T>
+    inline RingBufferView<T> make_ring_view(void* storage, size_t maxElements) {
+        return RingBufferView<T>(storage, maxElements);
+    }
+
     // No make_ring() factory:
-    // RingBuffer<T, N> must be constructed with template parameters at compile time.
+    // RingBuffer<T, N>, SpscRingBuffer<T, N> and MpmcRingBuffer<T, N> must be constructed with template
+    // parameters at compile time; use make_ring_view() for a runtime capacity.
 
 } // namespace antBuffers
@@ -0,0 +1,188 @@
+#pragma once
+
+#if defined(__cpp_impl_coroutine) && __has_include(<coroutine>)
+
+#include <coroutine>
+#include <optional>
+#include <utility>
+
+namespace antBuffers {
+/**
+ * @file async_ring.h
+ * @brief C++20 coroutine awaitables over a ring buffer.
+ *
+ * Only available when compiled as C++20 with coroutine support; the rest of
+ * the library stays C++17.
+ */
+
+/**
+ * @brief Adds co_await-able async_push()/async_pop() to a ring.
+ *
+ * A coroutine that finds the ring empty (or full) suspends and is queued on
+ * an intrusive waiter list held in its own awaiter, so waiting allocates
+ * nothing. The peer's next operation hands the element over directly and
+ * resumes the waiter inline on the peer's thread, so one thread can drive
+ * any number of streams without polling or a thread per waiter.
+ *
+ * Intended for a single-threaded executor: all calls, including the
+ * non-coroutine push() and pop(), must come from the same thread. Wrap a
+ * RingBuffer; the lock-free rings give no benefit here. A suspended awaiter
+ * must not be destroyed before it is resumed.
+ *
+ * @tparam Ring Ring type with bool push(T&&) that leaves its argument
+ *              untouched on failure, bool pop(T&) and bool
+ *              pop(std::optional<T>&), such as RingBuffer. async_pop() uses
+ *              the optional form, so T need not be default-constructible.
+ */
+template<typename Ring>
+class AsyncRing {
+public:
+    using value_type = typename Ring::value_type;  /**< Element type stored in the ring. */
+
+    class PopAwaiter;
+    class PushAwaiter;
+
+    AsyncRing() = default;
+
+    AsyncRing(const AsyncRing &) = delete;
+    AsyncRing &operator=(const AsyncRing &) = delete;
+
+    /**
+     * @brief Push a value without suspending, waking a waiting consumer.
+     *
+     * @return true if the value was delivered; false if the ring is full.
+     */
+    bool push(value_type v) {
+        return offer(v);
+    }
+
+    /**
+     * @brief Pop the oldest element without suspending, waking a waiting producer.
+     *
+     * @return true if an element was popped; false if the ring is empty.
+     */
+    bool pop(value_type &out) {
+        return take(out);
+    }
+
+    /**
+     * @brief Await the next element: `value_type v = co_await ring.async_pop();`
+     */
+    PopAwaiter async_pop() { return PopAwaiter(*this); }
+
+    /**
+     * @brief Await space for @p v: `co_await ring.async_push(std::move(v));`
+     */
+    PushAwaiter async_push(value_type v) { return PushAwaiter(*this, std::move(v)); }
+
+    /** @brief Direct access to the wrapped ring, e.g. for size() or capacity(). */
+    const Ring &ring() const { return ring_; }
+
+    /** @brief Awaiter returned by async_pop(). */
+    class PopAwaiter {
+    public:
+        explicit PopAwaiter(AsyncRing &owner) : owner_(owner) {}
+
+        bool await_ready() { return owner_.take(value_); }
+
+        void await_suspend(std::coroutine_handle<> h) {
+            handle_ = h;
+            owner_.popWaiters_.append(this);
+        }
+
+        value_type await_resume() { return std::move(*value_); }
+
+    private:
+        friend class AsyncRing;
+        template<typename> friend struct WaitList;
+
+        AsyncRing                &owner_;
+        std::optional<value_type> value_;            /**< Filled before resumption. */
+        std::coroutine_handle<>   handle_;
+        PopAwaiter               *next_ = nullptr;   /**< Next waiter in FIFO order. */
+    };
+
+    /** @brief Awaiter returned by async_push(). */
+    class PushAwaiter {
+    public:
+        PushAwaiter(AsyncRing &owner, value_type v) : owner_(owner), value_(std::move(v)) {}
+
+        bool await_ready() { return owner_.offer(value_); }
+
+        void await_suspend(std::coroutine_handle<> h) {
+            handle_ = h;
+            owner_.pushWaiters_.append(this);
+        }
+
+        void await_resume() {}
+
+    private:
+        friend class AsyncRing;
+        template<typename> friend struct WaitList;
+
+        AsyncRing               &owner_;
+        value_type               value_;             /**< Moved into the ring before resumption. */
+        std::coroutine_handle<>  handle_;
+        PushAwaiter             *next_ = nullptr;    /**< Next waiter in FIFO order. */
+    };
+
+private:
+    /** @brief Intrusive FIFO of suspended awaiters. */
+    template<typename W>
+    struct WaitList {
+        W *head = nullptr;
+        W *tail = nullptr;
+
+        void append(W *w) {
+            w->next_ = nullptr;
+            if (tail) tail->next_ = w; else head = w;
+            tail = w;
+        }
+
+        W *take() {
+            W *w = head;
+            if (w) {
+                head = w->next_;
+                if (!head) tail = nullptr;
+            }
+            return w;
+        }
+    };
+
+    /**
+     * @brief Deliver @p v to a waiting consumer or the ring.
+     *
+     * Consumers only wait while the ring is empty, so handing straight to
+     * the first one keeps FIFO order. @p v is left untouched on failure.
+     */
+    bool offer(value_type &v) {
+        if (PopAwaiter *w = popWaiters_.take()) {
+            w->value_.emplace(std::move(v));
+            w->handle_.resume();
+            return true;
+        }
+        return ring_.push(std::move(v));
+    }
+
+    /**
+     * @brief Pop into @p out, then refill the freed slot from a waiting producer.
+     *
+     * @p out is a value_type or a std::optional<value_type>.
+     */
+    template<typename Out>
+    bool take(Out &out) {
+        if (!ring_.pop(out)) return false;
+        if (PushAwaiter *w = pushWaiters_.take()) {
+            ring_.push(std::move(w->value_));
+            w->handle_.resume();
+        }
+        return true;
+    }
+
+    Ring                  ring_;         /**< Wrapped ring. */
+    WaitList<PopAwaiter>  popWaiters_;   /**< Consumers suspended on an empty ring. */
+    WaitList<PushAwaiter> pushWaiters_;  /**< Producers suspended on a full ring. */
+};
+} // namespace antBuffers
+
+#endif // coroutine support
@@ -0,0 +1,190 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <mutex>
+#include <utility>
+
+#include "ring_detail.h"
+
+namespace antBuffers {
+/**
+ * @file blocking_ring.h
+ * @brief Blocking push/pop with adaptive spin-then-park over any ring.
+ *
+ * Wraps SpscRingBuffer or MpmcRingBuffer so consumers can wait for data (and
+ * producers for space) without busy-polling a core or sleeping blindly.
+ */
+
+namespace detail {
+/**
+ * @brief Park/unpark point that only costs a syscall when someone is parked.
+ *
+ * A waiter registers itself before its final re-check of the ring, and a
+ * notifier checks for registered waiters after its ring operation; the
+ * seq_cst fences on both sides guarantee at least one of them sees the
+ * other, so no wakeup is lost. With nobody parked, notify() is one fence and
+ * one relaxed load.
+ */
+class WaitPoint {
+public:
+    /**
+     * @brief Block until @p ready() returns true or @p deadline passes.
+     *
+     * @return Result of the last call to @p ready().
+     */
+    template<typename Ready, typename Clock, typename Duration>
+    bool wait(Ready &&ready, const std::chrono::time_point<Clock, Duration> &deadline) {
+        std::unique_lock<std::mutex> lock(mutex_);
+        waiters_.fetch_add(1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        bool ok = ready();
+        while (!ok && cv_.wait_until(lock, deadline) != std::cv_status::timeout) {
+            ok = ready();
+        }
+        if (!ok) ok = ready();  // One last try in case the wakeup raced the timeout.
+        waiters_.fetch_sub(1, std::memory_order_relaxed);
+        return ok;
+    }
+
+    /**
+     * @brief Wake one parked thread, if there is one.
+     */
+    void notify() {
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (waiters_.load(std::memory_order_relaxed) == 0) return;
+        // Taking the lock orders us after a waiter's re-check, so it is
+        // either about to see our update or already inside wait_until().
+        { std::lock_guard<std::mutex> lock(mutex_); }
+        cv_.notify_one();
+    }
+
+private:
+    std::atomic<size_t>     waiters_{0}; /**< Threads registered to park. */
+    std::mutex              mutex_;      /**< Orders waiter re-check against notify. */
+    std::condition_variable cv_;         /**< Where parked threads sleep. */
+};
+} // namespace detail
+
+/**
+ * @brief Adds blocking push_wait()/pop_wait() to a non-blocking ring.
+ *
+ * Waiting first spins for a short, bounded number of retries, which gives a
+ * sub-microsecond handoff when the peer is active, and then parks the thread
+ * until the peer's next operation or the timeout. The non-blocking push() and
+ * pop() also wake a parked peer, so all access should go through this
+ * wrapper. Concurrency rules are those of the wrapped ring (e.g. one producer
+ * and one consumer for SpscRingBuffer).
+ *
+ * @tparam Ring Ring type with bool push(const T&), push(T&&) and pop(T&),
+ *              such as SpscRingBuffer or MpmcRingBuffer.
+ */
+template<typename Ring>
+class BlockingRing {
+public:
+    using value_type = typename Ring::value_type;  /**< Element type stored in the ring. */
+
+    /** @brief Retries before a waiting thread parks. */
+    static constexpr int spinLimit = 128;
+
+    BlockingRing() = default;
+
+    BlockingRing(const BlockingRing &) = delete;
+    BlockingRing &operator=(const BlockingRing &) = delete;
+
+    /**
+     * @brief Push a copy of a value without blocking.
+     *
+     * @return true if the value was pushed; false if the ring is full.
+     */
+    bool push(const value_type &v) {
+        if (!ring_.push(v)) return false;
+        notEmpty_.notify();
+        return true;
+    }
+
+    /**
+     * @brief Push a movable value without blocking.
+     *
+     * @return true if the value was pushed; false if the ring is full.
+     */
+    bool push(value_type &&v) {
+        if (!ring_.push(std::move(v))) return false;
+        notEmpty_.notify();
+        return true;
+    }
+
+    /**
+     * @brief Pop the oldest element without blocking.
+     *
+     * @return true if an element was popped; false if the ring is empty.
+     */
+    bool pop(value_type &out) {
+        if (!ring_.pop(out)) return false;
+        notFull_.notify();
+        return true;
+    }
+
+    /**
+     * @brief Push a copy of a value, waiting up to @p timeout for space.
+     *
+     * @return true if the value was pushed; false on timeout.
+     */
+    template<typename Rep, typename Period>
+    bool push_wait(const value_type &v, const std::chrono::duration<Rep, Period> &timeout) {
+        if (!waitFor(notFull_, timeout, [&] { return ring_.push(v); })) return false;
+        notEmpty_.notify();
+        return true;
+    }
+
+    /**
+     * @brief Push a movable value, waiting up to @p timeout for space.
+     *
+     * @p v is only moved from if the push succeeds.
+     *
+     * @return true if the value was pushed; false on timeout.
+     */
+    template<typename Rep, typename Period>
+    bool push_wait(value_type &&v, const std::chrono::duration<Rep, Period> &timeout) {
+        if (!waitFor(notFull_, timeout, [&] { return ring_.push(std::move(v)); })) return false;
+        notEmpty_.notify();
+        return true;
+    }
+
+    /**
+     * @brief Pop the oldest element, waiting up to @p timeout for one to arrive.
+     *
+     * @return true if an element was popped; false on timeout.
+     */
+    template<typename Rep, typename Period>
+    bool pop_wait(value_type &out, const std::chrono::duration<Rep, Period> &timeout) {
+        if (!waitFor(notEmpty_, timeout, [&] { return ring_.pop(out); })) return false;
+        notFull_.notify();
+        return true;
+    }
+
+    /** @brief Direct access to the wrapped ring, e.g. for size() or capacity(). */
+    const Ring &ring() const { return ring_; }
+
+private:
+    /**
+     * @brief Retry @p attempt with a short spin, then park on @p point.
+     */
+    template<typename Rep, typename Period, typename Attempt>
+    static bool waitFor(detail::WaitPoint &point, const std::chrono::duration<Rep, Period> &timeout,
+                        Attempt &&attempt) {
+        for (int i = 0; i < spinLimit; ++i) {
+            if (attempt()) return true;
+            detail::cpuRelax();
+        }
+        const auto deadline = std::chrono::steady_clock::now() + timeout;
+        return point.wait(attempt, deadline);
+    }
+
+    Ring              ring_;     /**< Wrapped non-blocking ring. */
+    detail::WaitPoint notEmpty_; /**< Consumers park here; producers notify. */
+    detail::WaitPoint notFull_;  /**< Producers park here; consumers notify. */
+};
+} // namespace antBuffers
@@ -2,6 +2,11 @@
 
 #include <cstdint>
 #include <cstddef>
+#include <cstring>
+
+#include "byte_codec.h"
+#include "record_writer.h"
+#include "varint_codec.h"
 
 namespace antBuffers {
 /**
@@ -9,7 +14,7 @@ namespace antBuffers {
  * @brief Simple sequential reader/writer over a raw byte buffer with endianness helpers.
  *
  * Provides a non-owning, index-based interface to a byte array for reading and
- * writing unsigned integer types in little- or big-endian formats. Designed for
+ * writing integer and IEEE floating-point types in little- or big-endian formats. Designed for
  * embedded and real-time systems with zero dynamic allocation.
  */
 class ByteBuffer
@@ -83,6 +88,47 @@ public:
      */
     size_t capacity() const { return capacity_; }
 
+    //-------------------------------------------------------------------------
+    // Generic
+    //-------------------------------------------------------------------------
+    /**
+     * @brief Read an integer or IEEE float stored in byte order @p E.
+     *
+     * The named accessors below are thin wrappers over this. The value is
+     * fetched with one unaligned load and byte-swapped only if @p E differs
+     * from the host order.
+     *
+     * @tparam V Integer or floating-point type of 1, 2, 4 or 8 bytes, e.g. uint32_t.
+     * @tparam E Byte order of the field.
+     * @param[out] out Where the value will be stored.
+     * @return true if sizeof(V) bytes were read; false if underflow.
+     */
+    template<typename V, Endian E>
+    bool read(V &out)
+    {
+        if (readRemaining() < sizeof(V)) return false;
+        out = detail::load<V, E>(data_ + tail_);
+        tail_ += sizeof(V);
+        return true;
+    }
+
+    /**
+     * @brief Write an integer or IEEE float in byte order @p E.
+     *
+     * @tparam V Integer or floating-point type of 1, 2, 4 or 8 bytes, e.g. uint32_t.
+     * @tparam E Byte order of the field.
+     * @param[in] v Value to write.
+     * @return true if sizeof(V) bytes were written; false if overflow.
+     */
+    template<typename V, Endian E>
+    bool write(V v)
+    {
+        if (writeRemaining() < sizeof(V)) return false;
+        detail::store<V, E>(data_ + head_, v);
+        head_ += sizeof(V);
+        return true;
+    }
+
     //-------------------------------------------------------------------------
     // 8-bit
     //-------------------------------------------------------------------------
@@ -121,14 +167,7 @@ public:
      * @param[out] out Where the 16-bit value will be stored.
      * @return true if two bytes were read; false if underflow.
      */
-    bool readUInt16LE(uint16_t &out)
-    {
-        if (readRemaining() < 2) return false;
-        out = uint16_t(data_[tail_])
-            | (uint16_t(data_[tail_ + 1]) << 8);
-        tail_ += 2;
-        return true;
-    }
+    bool readUInt16LE(uint16_t &out) { return read<uint16_t, Endian::Little>(out); }
 
     /**
      * @brief Read a big-endian 16-bit value.
@@ -136,14 +175,7 @@ public:
      * @param[out] out Where the 16-bit value will be stored.
      * @return true if two bytes were read; false if underflow.
      */
-    bool readUInt16BE(uint16_t &out)
-    {
-        if (readRemaining() < 2) return false;
-        out = (uint16_t(data_[tail_]) << 8)
-            |  uint16_t(data_[tail_ + 1]);
-        tail_ += 2;
-        return true;
-    }
+    bool readUInt16BE(uint16_t &out) { return read<uint16_t, Endian::Big>(out); }
 
     /**
      * @brief Write a little-endian 16-bit value.
@@ -151,14 +183,7 @@ public:
      * @param[in] v Value to write.
      * @return true if two bytes were written; false if overflow.
      */
-    bool writeUInt16LE(uint16_t v)
-    {
-        if (writeRemaining() < 2) return false;
-        data_[head_]     = uint8_t( v        & 0xFF);
-        data_[head_ + 1] = uint8_t((v >> 8)  & 0xFF);
-        head_ += 2;
-        return true;
-    }
+    bool writeUInt16LE(uint16_t v) { return write<uint16_t, Endian::Little>(v); }
 
     /**
      * @brief Write a big-endian 16-bit value.
@@ -166,14 +191,7 @@ public:
      * @param[in] v Value to write.
      * @return true if two bytes were written; false if overflow.
      */
-    bool writeUInt16BE(uint16_t v)
-    {
-        if (writeRemaining() < 2) return false;
-        data_[head_]     = uint8_t((v >> 8)  & 0xFF);
-        data_[head_ + 1] = uint8_t( v        & 0xFF);
-        head_ += 2;
-        return true;
-    }
+    bool writeUInt16BE(uint16_t v) { return write<uint16_t, Endian::Big>(v); }
 
     //-------------------------------------------------------------------------
     // 32-bit
@@ -184,16 +202,7 @@ public:
      * @param[out] out Where the 32-bit value will be stored.
      * @return true if four bytes were read; false if underflow.
      */
-    bool readUInt32LE(uint32_t &out)
-    {
-        if (readRemaining() < 4) return false;
-        out =  uint32_t(data_[tail_])
-            |  (uint32_t(data_[tail_ + 1]) << 8)
-            |  (uint32_t(data_[tail_ + 2]) << 16)
-            |  (uint32_t(data_[tail_ + 3]) << 24);
-        tail_ += 4;
-        return true;
-    }
+    bool readUInt32LE(uint32_t &out) { return read<uint32_t, Endian::Little>(out); }
 
     /**
      * @brief Read a big-endian 32-bit value.
@@ -201,16 +210,7 @@ public:
      * @param[out] out Where the 32-bit value will be stored.
      * @return true if four bytes were read; false if underflow.
      */
-    bool readUInt32BE(uint32_t &out)
-    {
-        if (readRemaining() < 4) return false;
-        out = (uint32_t(data_[tail_]) << 24)
-            | (uint32_t(data_[tail_ + 1]) << 16)
-            | (uint32_t(data_[tail_ + 2]) << 8)
-            |  uint32_t(data_[tail_ + 3]);
-        tail_ += 4;
-        return true;
-    }
+    bool readUInt32BE(uint32_t &out) { return read<uint32_t, Endian::Big>(out); }
 
     /**
      * @brief Write a little-endian 32-bit value.
@@ -218,35 +218,556 @@ public:
      * @param[in] v Value to write.
      * @return true if four bytes were written; false if overflow.
      */
-    bool writeUInt32LE(uint32_t v)
+    bool writeUInt32LE(uint32_t v) { return write<uint32_t, Endian::Little>(v); }
+
+    /**
+     * @brief Write a big-endian 32-bit value.
+     *
+     * @param[in] v Value to write.
+     * @return true if four bytes were written; false if overflow.
+     */
+    bool writeUInt32BE(uint32_t v) { return write<uint32_t, Endian::Big>(v); }
+
+    //-------------------------------------------------------------------------
+    // 64-bit
+    //-------------------------------------------------------------------------
+    /**
+     * @brief Read a little-endian 64-bit value.
+     *
+     * @param[out] out Where the 64-bit value will be stored.
+     * @return true if eight bytes were read; false if underflow.
+     */
+    bool readUInt64LE(uint64_t &out) { return read<uint64_t, Endian::Little>(out); }
+
+    /**
+     * @brief Read a big-endian 64-bit value.
+     *
+     * @param[out] out Where the 64-bit value will be stored.
+     * @return true if eight bytes were read; false if underflow.
+     */
+    bool readUInt64BE(uint64_t &out) { return read<uint64_t, Endian::Big>(out); }
+
+    /**
+     * @brief Write a little-endian 64-bit value.
+     *
+     * @param[in] v Value to write.
+     * @return true if eight bytes were written; false if overflow.
+     */
+    bool writeUInt64LE(uint64_t v) { return write<uint64_t, Endian::Little>(v); }
+
+    /**
+     * @brief Write a big-endian 64-bit value.
+     *
+     * @param[in] v Value to write.
+     * @return true if eight bytes were written; false if overflow.
+     */
+    bool writeUInt64BE(uint64_t v) { return write<uint64_t, Endian::Big>(v); }
+
+    //-------------------------------------------------------------------------
+    // Signed
+    //-------------------------------------------------------------------------
+    /**
+     * @brief Read one signed byte.
+     *
+     * @param[out] out Where the value will be stored.
+     * @return true if one byte was read; false if no data remains.
+     */
+    bool readInt8(int8_t &out) { return read<int8_t, Endian::Little>(out); }
+
+    /**
+     * @brief Write one signed byte.
+     *
+     * @param[in] v Value to write.
+     * @return true if one byte was written; false if buffer full.
+     */
+    bool writeInt8(int8_t v) { return write<int8_t, Endian::Little>(v); }
+
+    /**
+     * @brief Read a little-endian 16-bit two's complement value.
+     *
+     * @param[out] out Where the value will be stored.
+     * @return true if two bytes were read; false if underflow.
+     */
+    bool readInt16LE(int16_t &out) { return read<int16_t, Endian::Little>(out); }
+
+    /**
+     * @brief Read a big-endian 16-bit two's complement value.
+     *
+     * @param[out] out Where the value will be stored.
+     * @return true if two bytes were read; false if underflow.
+     */
+    bool readInt16BE(int16_t &out) { return read<int16_t, Endian::Big>(out); }
+
+    /**
+     * @brief Write a little-endian 16-bit two's complement value.
+     *
+     * @param[in] v Value to write.
+     * @return true if two bytes were written; false if overflow.
+     */
+    bool writeInt16LE(int16_t v) { return write<int16_t, Endian::Little>(v); }
+
+    /**
+     * @brief Write a big-endian 16-bit two's complement value.
+     *
+     * @param[in] v Value to write.
+     * @return true if two bytes were written; false if overflow.
+     */
+    bool writeInt16BE(int16_t v) { return write<int16_t, Endian::Big>(v); }
+
+    /**
+     * @brief Read a little-endian 32-bit two's complement value.
+     *
+     * @param[out] out Where the value will be stored.
+     * @return true if four bytes were read; false if underflow.
+     */
+    bool readInt32LE(int32_t &out) { return read<int32_t, Endian::Little>(out); }
+
+    /**
+     * @brief Read a big-endian 32-bit two's complement value.
+     *
+     * @param[out] out Where the value will be stored.
+     * @return true if four bytes were read; false if underflow.
+     */
+    bool readInt32BE(int32_t &out) { return read<int32_t, Endian::Big>(out); }
+
+    /**
+     * @brief Write a little-endian 32-bit two's complement value.
+     *
+     * @param[in] v Value to write.
+     * @return true if four bytes were written; false if overflow.
+     */
+    bool writeInt32LE(int32_t v) { return write<int32_t, Endian::Little>(v); }
+
+    /**
+     * @brief Write a big-endian 32-bit two's complement value.
+     *
+     * @param[in] v Value to write.
+     * @return true if four bytes were written; false if overflow.
+     */
+    bool writeInt32BE(int32_t v) { return write<int32_t, Endian::Big>(v); }
+
+    /**
+     * @brief Read a little-endian 64-bit two's complement value.
+     *
+     * @param[out] out Where the value will be stored.
+     * @return true if eight bytes were read; false if underflow.
+     */
+    bool readInt64LE(int64_t &out) { return read<int64_t, Endian::Little>(out); }
+
+    /**
+     * @brief Read a big-endian 64-bit two's complement value.
+     *
+     * @param[out] out Where the value will be stored.
+     * @return true if eight bytes were read; false if underflow.
+     */
+    bool readInt64BE(int64_t &out) { return read<int64_t, Endian::Big>(out); }
+
+    /**
+     * @brief Write a little-endian 64-bit two's complement value.
+     *
+     * @param[in] v Value to write.
+     * @return true if eight bytes were written; false if overflow.
+     */
+    bool writeInt64LE(int64_t v) { return write<int64_t, Endian::Little>(v); }
+
+    /**
+     * @brief Write a big-endian 64-bit two's complement value.
+     *
+     * @param[in] v Value to write.
+     * @return true if eight bytes were written; false if overflow.
+     */
+    bool writeInt64BE(int64_t v) { return write<int64_t, Endian::Big>(v); }
+
+    //-------------------------------------------------------------------------
+    // IEEE 754 floating point
+    //-------------------------------------------------------------------------
+    /**
+     * @brief Read a little-endian binary32 float.
+     *
+     * @param[out] out Where the value will be stored.
+     * @return true if four bytes were read; false if underflow.
+     */
+    bool readFloat32LE(float &out) { return read<float, Endian::Little>(out); }
+
+    /**
+     * @brief Read a big-endian binary32 float.
+     *
+     * @param[out] out Where the value will be stored.
+     * @return true if four bytes were read; false if underflow.
+     */
+    bool readFloat32BE(float &out) { return read<float, Endian::Big>(out); }
+
+    /**
+     * @brief Write a little-endian binary32 float.
+     *
+     * @param[in] v Value to write.
+     * @return true if four bytes were written; false if overflow.
+     */
+    bool writeFloat32LE(float v) { return write<float, Endian::Little>(v); }
+
+    /**
+     * @brief Write a big-endian binary32 float.
+     *
+     * @param[in] v Value to write.
+     * @return true if four bytes were written; false if overflow.
+     */
+    bool writeFloat32BE(float v) { return write<float, Endian::Big>(v); }
+
+    /**
+     * @brief Read a little-endian binary64 double.
+     *
+     * @param[out] out Where the value will be stored.
+     * @return true if eight bytes were read; false if underflow.
+     */
+    bool readFloat64LE(double &out) { return read<double, Endian::Little>(out); }
+
+    /**
+     * @brief Read a big-endian binary64 double.
+     *
+     * @param[out] out Where the value will be stored.
+     * @return true if eight bytes were read; false if underflow.
+     */
+    bool readFloat64BE(double &out) { return read<double, Endian::Big>(out); }
+
+    /**
+     * @brief Write a little-endian binary64 double.
+     *
+     * @param[in] v Value to write.
+     * @return true if eight bytes were written; false if overflow.
+     */
+    bool writeFloat64LE(double v) { return write<double, Endian::Little>(v); }
+
+    /**
+     * @brief Write a big-endian binary64 double.
+     *
+     * @param[in] v Value to write.
+     * @return true if eight bytes were written; false if overflow.
+     */
+    bool writeFloat64BE(double v) { return write<double, Endian::Big>(v); }
+
+    //-------------------------------------------------------------------------
+    // IEEE 754 half precision
+    //-------------------------------------------------------------------------
+    /**
+     * @brief Read a little-endian binary16 value and widen it to float.
+     *
+     * Widening is exact. Uses F16C when the target enables it.
+     *
+     * @param[out] out Where the value will be stored.
+     * @return true if two bytes were read; false if underflow.
+     */
+    bool readFloat16LE(float &out) { return readHalf<Endian::Little>(out); }
+
+    /**
+     * @brief Read a big-endian binary16 value and widen it to float.
+     *
+     * @param[out] out Where the value will be stored.
+     * @return true if two bytes were read; false if underflow.
+     */
+    bool readFloat16BE(float &out) { return readHalf<Endian::Big>(out); }
+
+    /**
+     * @brief Narrow a float to binary16 and write it little-endian.
+     *
+     * Rounds to nearest even: magnitudes from 65520 up become infinity,
+     * magnitudes below 2^-14 become subnormals, and those at or below 2^-25
+     * become zero. Uses F16C when the target enables it.
+     *
+     * @param[in] v Value to write.
+     * @return true if two bytes were written; false if overflow.
+     */
+    bool writeFloat16LE(float v) { return write<uint16_t, Endian::Little>(detail::floatToHalf(v)); }
+
+    /**
+     * @brief Narrow a float to binary16 and write it big-endian.
+     *
+     * Same rounding as writeFloat16LE().
+     *
+     * @param[in] v Value to write.
+     * @return true if two bytes were written; false if overflow.
+     */
+    bool writeFloat16BE(float v) { return write<uint16_t, Endian::Big>(detail::floatToHalf(v)); }
+
+    //-------------------------------------------------------------------------
+    // Varint (LEB128)
+    //-------------------------------------------------------------------------
+    /**
+     * @brief Write an unsigned LEB128 varint: 1 byte below 128, up to 10 bytes.
+     *
+     * @param[in] v Value to write.
+     * @return true if the encoding was written; false (nothing written) if overflow.
+     */
+    bool writeVarUInt(uint64_t v)
     {
-        if (writeRemaining() < 4) return false;
-        data_[head_]     = uint8_t( v        & 0xFF);
-        data_[head_ + 1] = uint8_t((v >> 8)  & 0xFF);
-        data_[head_ + 2] = uint8_t((v >> 16) & 0xFF);
-        data_[head_ + 3] = uint8_t((v >> 24) & 0xFF);
-        head_ += 4;
+        if (writeRemaining() < detail::varUIntSize(v)) return false;
+        head_ += detail::encodeVarUInt(data_ + head_, v);
         return true;
     }
 
     /**
-     * @brief Write a big-endian 32-bit value.
+     * @brief Read an unsigned LEB128 varint.
+     *
+     * @param[out] out Where the value will be stored.
+     * @return true if a value was read; false (nothing consumed) if the
+     *         varint is truncated or longer than 64 bits.
+     */
+    bool readVarUInt(uint64_t &out)
+    {
+        const size_t n = detail::decodeVarUInt(data_ + tail_, readRemaining(), out);
+        tail_ += n;
+        return n != 0;
+    }
+
+    /**
+     * @brief Write a signed value as a ZigZag varint, so small magnitudes of
+     *        either sign take one byte.
      *
      * @param[in] v Value to write.
-     * @return true if four bytes were written; false if overflow.
+     * @return true if the encoding was written; false (nothing written) if overflow.
      */
-    bool writeUInt32BE(uint32_t v)
+    bool writeVarInt(int64_t v) { return writeVarUInt(detail::zigZagEncode(v)); }
+
+    /**
+     * @brief Read a ZigZag varint written by writeVarInt().
+     *
+     * @param[out] out Where the value will be stored.
+     * @return true if a value was read; false (nothing consumed) if invalid or truncated.
+     */
+    bool readVarInt(int64_t &out)
     {
-        if (writeRemaining() < 4) return false;
-        data_[head_]     = uint8_t((v >> 24) & 0xFF);
-        data_[head_ + 1] = uint8_t((v >> 16) & 0xFF);
-        data_[head_ + 2] = uint8_t((v >> 8)  & 0xFF);
-        data_[head_ + 3] = uint8_t( v        & 0xFF);
-        head_ += 4;
+        uint64_t v;
+        if (!readVarUInt(v)) return false;
+        out = detail::zigZagDecode(v);
+        return true;
+    }
+
+    /**
+     * @brief Read @p count unsigned varints that each fit in 32 bits.
+     *
+     * Decodes with a SIMD kernel on SSSE3 and AArch64 NEON targets, which
+     * handles runs of one- and two-byte values a block at a time.
+     *
+     * @param[out] dst   Where the values will be stored; unspecified on failure.
+     * @param[in]  count Number of values.
+     * @return true if all values were read; false (nothing consumed) if the
+     *         data is truncated or a value exceeds 32 bits.
+     */
+    bool readVarUIntArray(uint32_t *dst, size_t count)
+    {
+        size_t used = 0;
+        if (!detail::decodeVarUInt32Array(dst, count, data_ + tail_, readRemaining(), used)) return false;
+        tail_ += used;
+        return true;
+    }
+
+    //-------------------------------------------------------------------------
+    // Records
+    //-------------------------------------------------------------------------
+    /**
+     * @brief Start a record of up to @p n bytes, checked once here instead of per field.
+     *
+     * Fill it with the writer's unchecked put* calls (use RecordWriter::ensure()
+     * to extend a variable-length record), then commit it with endRecord().
+     * If @p n bytes do not fit, the writer starts out failed and discards
+     * every put.
+     *
+     * @param[in] n Bytes the following puts may write.
+     * @return Writer positioned at writePosition().
+     */
+    RecordWriter beginRecord(size_t n)
+    {
+        RecordWriter w(data_ + head_, data_ + head_ + writeRemaining());
+        w.ensure(n);
+        return w;
+    }
+
+    /**
+     * @brief Commit a record started with beginRecord().
+     *
+     * The single error check for the whole record.
+     *
+     * @param[in] w Writer returned by beginRecord() on this buffer.
+     * @return true if every ensure() succeeded and the record was appended;
+     *         false (writePosition() unchanged) otherwise, or if the buffer was
+     *         written to since beginRecord().
+     */
+    bool endRecord(const RecordWriter &w)
+    {
+        if (!w.ok() || w.begin_ != data_ + head_) return false;
+        head_ += w.size();
+        return true;
+    }
+
+    //-------------------------------------------------------------------------
+    // Bulk
+    //-------------------------------------------------------------------------
+    /**
+     * @brief Write @p n raw bytes with a single bounds check.
+     *
+     * @param[in] src Bytes to write.
+     * @param[in] n   Number of bytes.
+     * @return true if all bytes were written; false (nothing written) if overflow.
+     */
+    bool writeBytes(const uint8_t *src, size_t n)
+    {
+        if (writeRemaining() < n) return false;
+        if (n) std::memcpy(data_ + head_, src, n);
+        head_ += n;
+        return true;
+    }
+
+    /**
+     * @brief Read @p n raw bytes with a single bounds check.
+     *
+     * @param[out] dst Where the bytes will be stored.
+     * @param[in]  n   Number of bytes.
+     * @return true if all bytes were read; false (nothing read) if underflow.
+     */
+    bool readBytes(uint8_t *dst, size_t n)
+    {
+        if (readRemaining() < n) return false;
+        if (n) std::memcpy(dst, data_ + tail_, n);
+        tail_ += n;
+        return true;
+    }
+
+    //-------------------------------------------------------------------------
+    // Arrays
+    //
+    // One bounds check per call. Arrays already in the wire order are copied
+    // with memcpy; others go through a byte-swap kernel (SIMD when enabled).
+    //-------------------------------------------------------------------------
+    /**
+     * @brief Write @p count little-endian 16-bit values.
+     *
+     * @param[in] src   Values to write.
+     * @param[in] count Number of values.
+     * @return true if all values were written; false (nothing written) if overflow.
+     */
+    bool writeUInt16ArrayLE(const uint16_t *src, size_t count)
+    {
+        if (count > writeRemaining() / 2) return false;
+        detail::storeArray<Endian::Little>(data_ + head_, src, count);
+        head_ += count * 2;
+        return true;
+    }
+
+    /**
+     * @brief Read @p count little-endian 16-bit values.
+     *
+     * @param[out] dst   Where the values will be stored.
+     * @param[in]  count Number of values.
+     * @return true if all values were read; false (nothing read) if underflow.
+     */
+    bool readUInt16ArrayLE(uint16_t *dst, size_t count)
+    {
+        if (count > readRemaining() / 2) return false;
+        detail::loadArray<Endian::Little>(dst, data_ + tail_, count);
+        tail_ += count * 2;
+        return true;
+    }
+
+    /**
+     * @brief Write @p count big-endian 16-bit values.
+     *
+     * @param[in] src   Values to write.
+     * @param[in] count Number of values.
+     * @return true if all values were written; false (nothing written) if overflow.
+     */
+    bool writeUInt16ArrayBE(const uint16_t *src, size_t count)
+    {
+        if (count > writeRemaining() / 2) return false;
+        detail::storeArray<Endian::Big>(data_ + head_, src, count);
+        head_ += count * 2;
+        return true;
+    }
+
+    /**
+     * @brief Read @p count big-endian 16-bit values.
+     *
+     * @param[out] dst   Where the values will be stored.
+     * @param[in]  count Number of values.
+     * @return true if all values were read; false (nothing read) if underflow.
+     */
+    bool readUInt16ArrayBE(uint16_t *dst, size_t count)
+    {
+        if (count > readRemaining() / 2) return false;
+        detail::loadArray<Endian::Big>(dst, data_ + tail_, count);
+        tail_ += count * 2;
+        return true;
+    }
+
+    /**
+     * @brief Write @p count little-endian 32-bit values.
+     *
+     * @param[in] src   Values to write.
+     * @param[in] count Number of values.
+     * @return true if all values were written; false (nothing written) if overflow.
+     */
+    bool writeUInt32ArrayLE(const uint32_t *src, size_t count)
+    {
+        if (count > writeRemaining() / 4) return false;
+        detail::storeArray<Endian::Little>(data_ + head_, src, count);
+        head_ += count * 4;
+        return true;
+    }
+
+    /**
+     * @brief Read @p count little-endian 32-bit values.
+     *
+     * @param[out] dst   Where the values will be stored.
+     * @param[in]  count Number of values.
+     * @return true if all values were read; false (nothing read) if underflow.
+     */
+    bool readUInt32ArrayLE(uint32_t *dst, size_t count)
+    {
+        if (count > readRemaining() / 4) return false;
+        detail::loadArray<Endian::Little>(dst, data_ + tail_, count);
+        tail_ += count * 4;
+        return true;
+    }
+
+    /**
+     * @brief Write @p count big-endian 32-bit values.
+     *
+     * @param[in] src   Values to write.
+     * @param[in] count Number of values.
+     * @return true if all values were written; false (nothing written) if overflow.
+     */
+    bool writeUInt32ArrayBE(const uint32_t *src, size_t count)
+    {
+        if (count > writeRemaining() / 4) return false;
+        detail::storeArray<Endian::Big>(data_ + head_, src, count);
+        head_ += count * 4;
+        return true;
+    }
+
+    /**
+     * @brief Read @p count big-endian 32-bit values.
+     *
+     * @param[out] dst   Where the values will be stored.
+     * @param[in]  count Number of values.
+     * @return true if all values were read; false (nothing read) if underflow.
+     */
+    bool readUInt32ArrayBE(uint32_t *dst, size_t count)
+    {
+        if (count > readRemaining() / 4) return false;
+        detail::loadArray<Endian::Big>(dst, data_ + tail_, count);
+        tail_ += count * 4;
         return true;
     }
 
 private:
+    /** @brief Read binary16 bits in byte order @p E and widen them to float. */
+    template<Endian E>
+    bool readHalf(float &out)
+    {
+        uint16_t bits;
+        if (!read<uint16_t, E>(bits)) return false;
+        out = detail::halfToFloat(bits);
+        return true;
+    }
+
     uint8_t *data_;       /**< Pointer to the external byte array. */
     size_t   capacity_;   /**< Total size of the array in bytes. */
     size_t   head_ = 0;  /**< Next index to write. */
@@ -0,0 +1,286 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+#if defined(__AVX2__) || defined(__F16C__)
+#include <immintrin.h>
+#elif defined(__SSSE3__)
+#include <tmmintrin.h>
+#elif defined(__ARM_NEON)
+#include <arm_neon.h>
+#endif
+
+namespace antBuffers {
+/**
+ * @file byte_codec.h
+ * @brief Unchecked little/big-endian loads and stores on raw byte pointers.
+ *
+ * Shared by the byte containers so every one encodes values identically.
+ * Callers are responsible for bounds checks.
+ */
+
+/**
+ * @brief Byte order of a field on the wire.
+ */
+enum class Endian {
+    Little,  /**< Least-significant byte first. */
+    Big      /**< Most-significant byte first (network order). */
+};
+
+namespace detail {
+/**
+ * @brief Byte order of the target.
+ *
+ * C++17 has no std::endian, so this uses the compiler's __BYTE_ORDER__ and
+ * assumes little-endian where that is not defined.
+ */
+#if defined(__BYTE_ORDER__) && defined(__ORDER_BIG_ENDIAN__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+constexpr Endian hostEndian = Endian::Big;
+#else
+constexpr Endian hostEndian = Endian::Little;
+#endif
+
+/** @brief Whether the target stores integers least-significant byte first. */
+constexpr bool hostLittleEndian = hostEndian == Endian::Little;
+
+/**
+ * @brief Reverse the bytes of an unsigned integer.
+ */
+template<typename V>
+inline V byteSwap(V v)
+{
+    static_assert(std::is_unsigned<V>::value, "byteSwap() takes an unsigned integer");
+    if constexpr (sizeof(V) == 1) {
+        return v;
+    } else {
+#if defined(__GNUC__) || defined(__clang__)
+        if constexpr (sizeof(V) == 2) return V(__builtin_bswap16(v));
+        else if constexpr (sizeof(V) == 4) return V(__builtin_bswap32(v));
+        else return V(__builtin_bswap64(v));
+#else
+        V r = 0;
+        for (size_t i = 0; i < sizeof(V); ++i) {
+            r = V((r << 8) | (v & 0xFF));
+            v = V(v >> 8);
+        }
+        return r;
+#endif
+    }
+}
+
+/** @brief Unsigned integer with the same size as @p V, used to swap its bytes. */
+template<typename V>
+using BitsOf = std::conditional_t<sizeof(V) == 1, uint8_t,
+               std::conditional_t<sizeof(V) == 2, uint16_t,
+               std::conditional_t<sizeof(V) == 4, uint32_t, uint64_t>>>;
+
+/**
+ * @brief Load an integer or IEEE float stored in byte order @p E at @p p.
+ *
+ * One unaligned memcpy load, plus a byte swap only when @p E differs from
+ * the host order; both compile to a single instruction on common targets,
+ * even in unoptimized builds where shift-and-or chains are not fused.
+ * Signed and floating-point values go through their bit pattern.
+ */
+template<typename V, Endian E>
+inline V load(const uint8_t *p)
+{
+    static_assert(std::is_arithmetic<V>::value && sizeof(V) <= 8 && (sizeof(V) & (sizeof(V) - 1)) == 0,
+                  "load() takes an integer or floating-point type of 1, 2, 4 or 8 bytes");
+    BitsOf<V> bits;
+    std::memcpy(&bits, p, sizeof(V));
+    if constexpr (E != hostEndian) bits = byteSwap(bits);
+    V v;
+    std::memcpy(&v, &bits, sizeof(V));
+    return v;
+}
+
+/**
+ * @brief Store an integer or IEEE float at @p p in byte order @p E.
+ */
+template<typename V, Endian E>
+inline void store(uint8_t *p, V v)
+{
+    static_assert(std::is_arithmetic<V>::value && sizeof(V) <= 8 && (sizeof(V) & (sizeof(V) - 1)) == 0,
+                  "store() takes an integer or floating-point type of 1, 2, 4 or 8 bytes");
+    BitsOf<V> bits;
+    std::memcpy(&bits, &v, sizeof(V));
+    if constexpr (E != hostEndian) bits = byteSwap(bits);
+    std::memcpy(p, &bits, sizeof(V));
+}
+
+//-------------------------------------------------------------------------
+// IEEE 754 half precision
+//-------------------------------------------------------------------------
+/**
+ * @brief Convert a float to IEEE binary16 bits, rounding to nearest even.
+ *
+ * Uses the F16C instruction when the target enables it. Magnitudes from
+ * 65520 up become infinity, magnitudes below 2^-14 become subnormals, those
+ * at or below 2^-25 become zero, and NaN stays NaN.
+ */
+inline uint16_t floatToHalf(float v)
+{
+#if defined(__F16C__)
+    return uint16_t(_cvtss_sh(v, _MM_FROUND_TO_NEAREST_INT));
+#else
+    uint32_t f;
+    std::memcpy(&f, &v, sizeof(f));
+    const uint32_t sign = (f >> 16) & 0x8000u;
+    const uint32_t exp  = (f >> 23) & 0xFFu;
+    uint32_t mant       = f & 0x7FFFFFu;
+
+    if (exp == 0xFF) return uint16_t(sign | 0x7C00u | (mant ? 0x200u | (mant >> 13) : 0));
+    const int e = int(exp) - 127 + 15;
+    if (e >= 0x1F) return uint16_t(sign | 0x7C00u);
+    if (e <= 0) {
+        if (e < -10) return uint16_t(sign);
+        mant |= 0x800000u;
+        const unsigned shift = unsigned(14 - e);
+        uint32_t half = mant >> shift;
+        const uint32_t rem = mant & ((1u << shift) - 1);
+        const uint32_t halfway = 1u << (shift - 1);
+        if (rem > halfway || (rem == halfway && (half & 1))) ++half;
+        return uint16_t(sign | half);
+    }
+    uint32_t half = (uint32_t(e) << 10) | (mant >> 13);
+    const uint32_t rem = mant & 0x1FFFu;
+    if (rem > 0x1000u || (rem == 0x1000u && (half & 1))) ++half;  // May carry into infinity.
+    return uint16_t(sign | half);
+#endif
+}
+
+/**
+ * @brief Convert IEEE binary16 bits to a float (exact).
+ */
+inline float halfToFloat(uint16_t h)
+{
+#if defined(__F16C__)
+    return _cvtsh_ss(h);
+#else
+    const uint32_t sign = uint32_t(h & 0x8000u) << 16;
+    const uint32_t exp  = (h >> 10) & 0x1Fu;
+    const uint32_t mant = h & 0x3FFu;
+    uint32_t f;
+    if (exp == 0) {
+        // Zero or subnormal: mant * 2^-24 is exact in a float.
+        const float mag = float(mant) * (1.0f / 16777216.0f);
+        std::memcpy(&f, &mag, sizeof(f));
+        f |= sign;
+    } else if (exp == 0x1F) {
+        f = sign | 0x7F800000u | (mant << 13);
+    } else {
+        f = sign | ((exp + 112) << 23) | (mant << 13);
+    }
+    float v;
+    std::memcpy(&v, &f, sizeof(v));
+    return v;
+#endif
+}
+
+inline uint16_t loadUInt16LE(const uint8_t *p) { return load<uint16_t, Endian::Little>(p); }
+inline uint16_t loadUInt16BE(const uint8_t *p) { return load<uint16_t, Endian::Big>(p); }
+inline uint32_t loadUInt32LE(const uint8_t *p) { return load<uint32_t, Endian::Little>(p); }
+inline uint32_t loadUInt32BE(const uint8_t *p) { return load<uint32_t, Endian::Big>(p); }
+
+inline void storeUInt16LE(uint8_t *p, uint16_t v) { store<uint16_t, Endian::Little>(p, v); }
+inline void storeUInt16BE(uint8_t *p, uint16_t v) { store<uint16_t, Endian::Big>(p, v); }
+inline void storeUInt32LE(uint8_t *p, uint32_t v) { store<uint32_t, Endian::Little>(p, v); }
+inline void storeUInt32BE(uint8_t *p, uint32_t v) { store<uint32_t, Endian::Big>(p, v); }
+
+//-------------------------------------------------------------------------
+// Array kernels
+//-------------------------------------------------------------------------
+/**
+ * @brief Copy @p count groups of @p Width bytes, reversing the bytes of each group.
+ *
+ * Used to convert arrays between host order and the other byte order. The
+ * same kernel serves loads and stores, since reversing is its own inverse.
+ * Uses one pshufb per 32 bytes (AVX2) or 16 bytes (SSSE3), or NEON vrev,
+ * when the target enables them; the remainder is one bswap per value.
+ */
+template<size_t Width>
+inline void copySwapped(uint8_t *dst, const uint8_t *src, size_t count)
+{
+    static_assert(Width == 2 || Width == 4 || Width == 8, "unsupported element width");
+    size_t i = 0;
+    const size_t bytes = count * Width;
+#if defined(__AVX2__)
+    const __m256i mask = (Width == 2)
+        ? _mm256_setr_epi8(1, 0, 3, 2, 5, 4, 7, 6, 9, 8, 11, 10, 13, 12, 15, 14,
+                           1, 0, 3, 2, 5, 4, 7, 6, 9, 8, 11, 10, 13, 12, 15, 14)
+        : (Width == 4)
+        ? _mm256_setr_epi8(3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12,
+                           3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12)
+        : _mm256_setr_epi8(7, 6, 5, 4, 3, 2, 1, 0, 15, 14, 13, 12, 11, 10, 9, 8,
+                           7, 6, 5, 4, 3, 2, 1, 0, 15, 14, 13, 12, 11, 10, 9, 8);
+    for (; i + 32 <= bytes; i += 32) {
+        const __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(src + i));
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(dst + i), _mm256_shuffle_epi8(v, mask));
+    }
+#elif defined(__SSSE3__)
+    const __m128i mask = (Width == 2)
+        ? _mm_setr_epi8(1, 0, 3, 2, 5, 4, 7, 6, 9, 8, 11, 10, 13, 12, 15, 14)
+        : (Width == 4)
+        ? _mm_setr_epi8(3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12)
+        : _mm_setr_epi8(7, 6, 5, 4, 3, 2, 1, 0, 15, 14, 13, 12, 11, 10, 9, 8);
+    for (; i + 16 <= bytes; i += 16) {
+        const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src + i));
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(dst + i), _mm_shuffle_epi8(v, mask));
+    }
+#elif defined(__ARM_NEON)
+    for (; i + 16 <= bytes; i += 16) {
+        const uint8x16_t v = vld1q_u8(src + i);
+        if constexpr (Width == 2)      vst1q_u8(dst + i, vrev16q_u8(v));
+        else if constexpr (Width == 4) vst1q_u8(dst + i, vrev32q_u8(v));
+        else                           vst1q_u8(dst + i, vrev64q_u8(v));
+    }
+#endif
+#if defined(__GNUC__) || defined(__clang__)
+    using Word = std::conditional_t<Width == 2, uint16_t, std::conditional_t<Width == 4, uint32_t, uint64_t>>;
+    for (; i < bytes; i += Width) {
+        Word w;
+        std::memcpy(&w, src + i, Width);
+        if constexpr (Width == 2)      w = __builtin_bswap16(w);
+        else if constexpr (Width == 4) w = __builtin_bswap32(w);
+        else                           w = __builtin_bswap64(w);
+        std::memcpy(dst + i, &w, Width);
+    }
+#else
+    for (; i < bytes; i += Width) {
+        for (size_t k = 0; k < Width; ++k) dst[i + k] = src[i + Width - 1 - k];
+    }
+#endif
+}
+
+/**
+ * @brief Store @p count host-order values as consecutive fields in byte order @p E.
+ */
+template<Endian E, typename V>
+inline void storeArray(uint8_t *p, const V *src, size_t count)
+{
+    if constexpr (E == hostEndian || sizeof(V) == 1) {
+        if (count) std::memcpy(p, src, count * sizeof(V));
+    } else {
+        copySwapped<sizeof(V)>(p, reinterpret_cast<const uint8_t *>(src), count);
+    }
+}
+
+/**
+ * @brief Load @p count consecutive fields in byte order @p E into host-order values.
+ */
+template<Endian E, typename V>
+inline void loadArray(V *dst, const uint8_t *p, size_t count)
+{
+    if constexpr (E == hostEndian || sizeof(V) == 1) {
+        if (count) std::memcpy(dst, p, count * sizeof(V));
+    } else {
+        copySwapped<sizeof(V)>(reinterpret_cast<uint8_t *>(dst), p, count);
+    }
+}
+
+} // namespace detail
+} // namespace antBuffers
@@ -0,0 +1,291 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+#include "byte_codec.h"
+
+namespace antBuffers {
+/**
+ * @file byte_ring.h
+ * @brief Streaming circular byte buffer with ByteBuffer's typed accessors.
+ *
+ * Non-owning, like ByteBuffer, but reading frees space for further writes, so
+ * continuous UART/TCP ingest never needs resetWrite() or a memmove to compact.
+ */
+
+/**
+ * @brief Circular reader/writer over a raw byte array.
+ *
+ * Typed values may straddle the end of the array; they are assembled from
+ * both segments transparently. peek() reads without consuming and discard()
+ * drops bytes without copying them out. Not thread-safe, like ByteBuffer.
+ */
+class ByteRing
+{
+public:
+    /**
+     * @brief Construct a ByteRing over an existing byte array.
+     *
+     * @param buffer   Pointer to the raw byte array.
+     * @param capacity Total size of the array in bytes.
+     */
+    ByteRing(uint8_t *buffer, size_t capacity)
+        : data_(buffer), capacity_(capacity) {}
+
+    //-------------------------------------------------------------------------
+    // State
+    //-------------------------------------------------------------------------
+    /**
+     * @brief Get the total capacity of the ring.
+     *
+     * @return Maximum number of bytes that can be held at once.
+     */
+    size_t capacity() const { return capacity_; }
+
+    /**
+     * @brief How many bytes remain available to read.
+     */
+    size_t readRemaining() const { return size_; }
+
+    /**
+     * @brief How many bytes you can still write before the ring is full.
+     */
+    size_t writeRemaining() const { return capacity_ - size_; }
+
+    /**
+     * @brief Drop all unread data.
+     */
+    void clear() { tail_ = size_ = 0; }
+
+    //-------------------------------------------------------------------------
+    // Raw bytes
+    //-------------------------------------------------------------------------
+    /**
+     * @brief Append @p n bytes.
+     *
+     * @return true if all bytes were written; false (nothing written) if they don't fit.
+     */
+    bool writeBytes(const uint8_t *src, size_t n)
+    {
+        if (writeRemaining() < n) return false;
+        copyIn(src, n);
+        size_ += n;
+        return true;
+    }
+
+    /**
+     * @brief Read and consume @p n bytes.
+     *
+     * @return true if all bytes were read; false (nothing read) if fewer are available.
+     */
+    bool readBytes(uint8_t *dst, size_t n)
+    {
+        if (!peek(dst, n)) return false;
+        consume(n);
+        return true;
+    }
+
+    /**
+     * @brief Copy @p n bytes starting @p offset bytes into the unread data,
+     *        without consuming them.
+     *
+     * @return true if the range was available; false otherwise.
+     */
+    bool peek(uint8_t *dst, size_t n, size_t offset = 0) const
+    {
+        if (offset > size_ || size_ - offset < n) return false;
+        copyOut(offset, dst, n);
+        return true;
+    }
+
+    /**
+     * @brief Drop @p n unread bytes without copying them.
+     *
+     * @return true if discarded; false (nothing dropped) if fewer are available.
+     */
+    bool discard(size_t n)
+    {
+        if (n > size_) return false;
+        consume(n);
+        return true;
+    }
+
+    //-------------------------------------------------------------------------
+    // 8-bit
+    //-------------------------------------------------------------------------
+    /**
+     * @brief Read one byte.
+     *
+     * @param[out] out Where the value will be stored.
+     * @return true if one byte was read; false if no data remains.
+     */
+    bool readUInt8(uint8_t &out)
+    {
+        if (size_ < 1) return false;
+        out = data_[tail_];
+        consume(1);
+        return true;
+    }
+
+    /**
+     * @brief Write one byte.
+     *
+     * @param[in] v Value to write.
+     * @return true if one byte was written; false if ring full.
+     */
+    bool writeUInt8(uint8_t v)
+    {
+        if (writeRemaining() < 1) return false;
+        data_[wrap(tail_ + size_)] = v;
+        size_ += 1;
+        return true;
+    }
+
+    //-------------------------------------------------------------------------
+    // 16-bit
+    //-------------------------------------------------------------------------
+    /**
+     * @brief Read a little-endian 16-bit value.
+     *
+     * @param[out] out Where the 16-bit value will be stored.
+     * @return true if two bytes were read; false if underflow.
+     */
+    bool readUInt16LE(uint16_t &out) { return readValue<uint16_t, detail::loadUInt16LE>(out); }
+
+    /**
+     * @brief Read a big-endian 16-bit value.
+     *
+     * @param[out] out Where the 16-bit value will be stored.
+     * @return true if two bytes were read; false if underflow.
+     */
+    bool readUInt16BE(uint16_t &out) { return readValue<uint16_t, detail::loadUInt16BE>(out); }
+
+    /**
+     * @brief Write a little-endian 16-bit value.
+     *
+     * @param[in] v Value to write.
+     * @return true if two bytes were written; false if overflow.
+     */
+    bool writeUInt16LE(uint16_t v) { return writeValue<uint16_t, detail::storeUInt16LE>(v); }
+
+    /**
+     * @brief Write a big-endian 16-bit value.
+     *
+     * @param[in] v Value to write.
+     * @return true if two bytes were written; false if overflow.
+     */
+    bool writeUInt16BE(uint16_t v) { return writeValue<uint16_t, detail::storeUInt16BE>(v); }
+
+    //-------------------------------------------------------------------------
+    // 32-bit
+    //-------------------------------------------------------------------------
+    /**
+     * @brief Read a little-endian 32-bit value.
+     *
+     * @param[out] out Where the 32-bit value will be stored.
+     * @return true if four bytes were read; false if underflow.
+     */
+    bool readUInt32LE(uint32_t &out) { return readValue<uint32_t, detail::loadUInt32LE>(out); }
+
+    /**
+     * @brief Read a big-endian 32-bit value.
+     *
+     * @param[out] out Where the 32-bit value will be stored.
+     * @return true if four bytes were read; false if underflow.
+     */
+    bool readUInt32BE(uint32_t &out) { return readValue<uint32_t, detail::loadUInt32BE>(out); }
+
+    /**
+     * @brief Write a little-endian 32-bit value.
+     *
+     * @param[in] v Value to write.
+     * @return true if four bytes were written; false if overflow.
+     */
+    bool writeUInt32LE(uint32_t v) { return writeValue<uint32_t, detail::storeUInt32LE>(v); }
+
+    /**
+     * @brief Write a big-endian 32-bit value.
+     *
+     * @param[in] v Value to write.
+     * @return true if four bytes were written; false if overflow.
+     */
+    bool writeUInt32BE(uint32_t v) { return writeValue<uint32_t, detail::storeUInt32BE>(v); }
+
+private:
+    /** @brief Map a position in [0, 2 * capacity) back into the array. */
+    size_t wrap(size_t i) const { return (i >= capacity_) ? i - capacity_ : i; }
+
+    /** @brief Advance the read cursor by @p n bytes (n <= size_). */
+    void consume(size_t n)
+    {
+        tail_ = wrap(tail_ + n);
+        size_ -= n;
+    }
+
+    /** @brief Copy @p n unread bytes starting at @p offset into @p dst. */
+    void copyOut(size_t offset, uint8_t *dst, size_t n) const
+    {
+        const size_t start = wrap(tail_ + offset);
+        const size_t first = (n < capacity_ - start) ? n : capacity_ - start;
+        std::memcpy(dst, data_ + start, first);
+        std::memcpy(dst + first, data_, n - first);
+    }
+
+    /** @brief Copy @p n bytes from @p src into the free region. */
+    void copyIn(const uint8_t *src, size_t n)
+    {
+        const size_t start = wrap(tail_ + size_);
+        const size_t first = (n < capacity_ - start) ? n : capacity_ - start;
+        std::memcpy(data_ + start, src, first);
+        std::memcpy(data_, src + first, n - first);
+    }
+
+    /**
+     * @brief Decode one value in place, or from a scratch copy if it straddles
+     *        the end of the array.
+     */
+    template<typename V, V (*Load)(const uint8_t *)>
+    bool readValue(V &out)
+    {
+        constexpr size_t n = sizeof(V);
+        if (size_ < n) return false;
+        if (capacity_ - tail_ >= n) {
+            out = Load(data_ + tail_);
+        } else {
+            uint8_t tmp[n];
+            copyOut(0, tmp, n);
+            out = Load(tmp);
+        }
+        consume(n);
+        return true;
+    }
+
+    /**
+     * @brief Encode one value in place, or via a scratch copy if it straddles
+     *        the end of the array.
+     */
+    template<typename V, void (*Store)(uint8_t *, V)>
+    bool writeValue(V v)
+    {
+        constexpr size_t n = sizeof(V);
+        if (writeRemaining() < n) return false;
+        const size_t head = wrap(tail_ + size_);
+        if (capacity_ - head >= n) {
+            Store(data_ + head, v);
+        } else {
+            uint8_t tmp[n];
+            Store(tmp, v);
+            copyIn(tmp, n);
+        }
+        size_ += n;
+        return true;
+    }
+
+    uint8_t *data_;        /**< Pointer to the external byte array. */
+    size_t   capacity_;    /**< Total size of the array in bytes. */
+    size_t   tail_ = 0;    /**< Index of the next byte to read. */
+    size_t   size_ = 0;    /**< Number of unread bytes. */
+};
+} // namespace antBuffers
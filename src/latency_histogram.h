@@ -0,0 +1,121 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+namespace antBuffers {
+/**
+ * @file latency_histogram.h
+ * @brief Fixed-size log-linear (HDR-style) histogram for latency samples.
+ *
+ * Values below 2^SubBucketBits are counted exactly; above that, every power
+ * of two is split into 2^SubBucketBits linear sub-buckets, so any recorded
+ * value is known to within a relative error of 2^-SubBucketBits over the full
+ * 64-bit range, with no allocation and O(1) recording.
+ */
+
+/**
+ * @brief Log-linear histogram of unsigned 64-bit samples.
+ *
+ * record() is meant to be called from one thread; count(), percentile() and
+ * the other queries may be called from any thread and see a relaxed
+ * snapshot. Counters are single-writer relaxed atomics, so recording never
+ * issues a locked instruction.
+ *
+ * @tparam SubBucketBits log2 of the linear sub-buckets per power of two.
+ */
+template<unsigned SubBucketBits = 4>
+class LatencyHistogram {
+    static_assert(SubBucketBits >= 1 && SubBucketBits <= 16, "SubBucketBits must be in [1, 16]");
+
+public:
+    static constexpr size_t subBuckets = size_t(1) << SubBucketBits;       /**< Sub-buckets per power of two. */
+    static constexpr size_t bucketCount = (65 - SubBucketBits) * subBuckets; /**< Total counters. */
+
+    /**
+     * @brief Count one sample.
+     */
+    void record(uint64_t v) {
+        bump(counts_[indexOf(v)]);
+        bump(total_);
+        if (v > max_.load(std::memory_order_relaxed)) max_.store(v, std::memory_order_relaxed);
+    }
+
+    /** @brief Number of samples recorded. */
+    uint64_t count() const { return total_.load(std::memory_order_relaxed); }
+
+    /** @brief Largest sample recorded (exact), or 0 if none. */
+    uint64_t max() const { return max_.load(std::memory_order_relaxed); }
+
+    /**
+     * @brief Value at or below which @p p percent of samples fall.
+     *
+     * @param p Percentile in [0, 100], e.g. 99.0 for p99.
+     * @return Upper bound of the bucket holding that sample (never above max()),
+     *         or 0 if nothing has been recorded.
+     */
+    uint64_t percentile(double p) const {
+        const uint64_t n = count();
+        if (n == 0) return 0;
+        uint64_t rank = uint64_t(p / 100.0 * double(n) + 0.5);
+        if (rank == 0) rank = 1;
+        if (rank > n) rank = n;
+        uint64_t seen = 0;
+        for (size_t i = 0; i < bucketCount; ++i) {
+            seen += counts_[i].load(std::memory_order_relaxed);
+            if (seen >= rank) {
+                const uint64_t hi = highestIn(i);
+                const uint64_t m = max();
+                return hi < m ? hi : m;
+            }
+        }
+        return max();
+    }
+
+    /**
+     * @brief Samples counted in bucket @p i (see lowestIn()/highestIn()).
+     */
+    uint64_t bucket(size_t i) const { return counts_[i].load(std::memory_order_relaxed); }
+
+    /** @brief Bucket index that value @p v is counted in. */
+    static constexpr size_t indexOf(uint64_t v) {
+        if (v < subBuckets) return size_t(v);
+        const unsigned e = 63 - unsigned(__builtin_clzll(v));
+        const unsigned shift = e - SubBucketBits;
+        return size_t(shift + 1) * subBuckets + size_t((v >> shift) & (subBuckets - 1));
+    }
+
+    /** @brief Smallest value counted in bucket @p i. */
+    static constexpr uint64_t lowestIn(size_t i) {
+        if (i < subBuckets) return i;
+        const unsigned shift = unsigned(i / subBuckets) - 1;
+        return (uint64_t(subBuckets) + i % subBuckets) << shift;
+    }
+
+    /** @brief Largest value counted in bucket @p i. */
+    static constexpr uint64_t highestIn(size_t i) {
+        if (i < subBuckets) return i;
+        const unsigned shift = unsigned(i / subBuckets) - 1;
+        return lowestIn(i) + ((uint64_t(1) << shift) - 1);
+    }
+
+    /**
+     * @brief Zero every counter. Not atomic with respect to concurrent record().
+     */
+    void reset() {
+        for (auto &c : counts_) c.store(0, std::memory_order_relaxed);
+        total_.store(0, std::memory_order_relaxed);
+        max_.store(0, std::memory_order_relaxed);
+    }
+
+private:
+    static void bump(std::atomic<uint64_t> &c) {
+        c.store(c.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+    }
+
+    std::atomic<uint64_t> total_{0};              /**< Samples recorded. */
+    std::atomic<uint64_t> max_{0};                /**< Largest sample. */
+    std::atomic<uint64_t> counts_[bucketCount] {}; /**< Per-bucket sample counts. */
+};
+} // namespace antBuffers
@@ -0,0 +1,340 @@
+#pragma once
+
+#if defined(__linux__)
+
+#include <cstddef>
+#include <cstdint>
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include "byte_codec.h"
+#include "ring_detail.h"
+
+namespace antBuffers {
+/**
+ * @file mirrored_byte_ring.h
+ * @brief Byte ring whose storage is mapped twice, back to back (Linux only).
+ *
+ * Because byte i and byte i + capacity() are the same physical memory, every
+ * readable or writable region is a single contiguous pointer range, and frame
+ * decoders can run directly on ring memory without wrap handling or copies.
+ */
+
+/**
+ * @brief Circular byte buffer with wrap-free contiguous access.
+ *
+ * The backing memory comes from memfd_create() and is mapped twice into one
+ * reserved address range. The capacity is rounded up to a power of two that
+ * is at least one page, so cursors run freely and are masked.
+ *
+ * Construction can fail (e.g. no memfd support or address space exhausted);
+ * check valid() before use. An invalid ring has capacity() == 0 and every
+ * operation on it fails. Not thread-safe, like ByteBuffer.
+ */
+class MirroredByteRing
+{
+public:
+    /**
+     * @brief Map a mirrored ring of at least @p minCapacity bytes.
+     *
+     * @param minCapacity Minimum number of bytes the ring must hold.
+     */
+    explicit MirroredByteRing(size_t minCapacity)
+    {
+        const long page = ::sysconf(_SC_PAGESIZE);
+        const size_t pageSize = page > 0 ? size_t(page) : 4096;
+        const size_t cap = detail::nextPowerOfTwo(minCapacity < pageSize ? pageSize : minCapacity);
+        map(cap);
+    }
+
+    ~MirroredByteRing() { unmap(); }
+
+    MirroredByteRing(const MirroredByteRing &) = delete;
+    MirroredByteRing &operator=(const MirroredByteRing &) = delete;
+
+    MirroredByteRing(MirroredByteRing &&other) noexcept { take(other); }
+
+    MirroredByteRing &operator=(MirroredByteRing &&other) noexcept
+    {
+        if (this != &other) {
+            unmap();
+            take(other);
+        }
+        return *this;
+    }
+
+    /**
+     * @brief Whether the mapping was created successfully.
+     */
+    bool valid() const { return data_ != nullptr; }
+
+    /**
+     * @brief Get the total capacity of the ring.
+     *
+     * @return Maximum number of bytes that can be held at once.
+     */
+    size_t capacity() const { return capacity_; }
+
+    /**
+     * @brief How many bytes you can still write before the ring is full.
+     */
+    size_t writeRemaining() const { return capacity_ - readRemaining(); }
+
+    /**
+     * @brief How many bytes remain available to read.
+     */
+    size_t readRemaining() const { return head_ - tail_; }
+
+    /**
+     * @brief Drop all unread data.
+     */
+    void clear() { head_ = tail_ = 0; }
+
+    //-------------------------------------------------------------------------
+    // Zero-copy access
+    //-------------------------------------------------------------------------
+    /**
+     * @brief Start of the free region; writeRemaining() bytes are contiguous.
+     */
+    uint8_t *writePtr() { return data_ + (head_ & mask_); }
+
+    /**
+     * @brief Publish @p n bytes written through writePtr().
+     *
+     * @return true if committed; false if @p n exceeds writeRemaining().
+     */
+    bool commit(size_t n)
+    {
+        if (n > writeRemaining()) return false;
+        head_ += n;
+        return true;
+    }
+
+    /**
+     * @brief Start of the unread data; readRemaining() bytes are contiguous.
+     */
+    const uint8_t *readPtr() const { return data_ + (tail_ & mask_); }
+
+    /**
+     * @brief Release @p n bytes read through readPtr().
+     *
+     * @return true if released; false if @p n exceeds readRemaining().
+     */
+    bool consume(size_t n)
+    {
+        if (n > readRemaining()) return false;
+        tail_ += n;
+        return true;
+    }
+
+    //-------------------------------------------------------------------------
+    // 8-bit
+    //-------------------------------------------------------------------------
+    /**
+     * @brief Read one byte.
+     *
+     * @param[out] out Where the value will be stored.
+     * @return true if one byte was read; false if no data remains.
+     */
+    bool readUInt8(uint8_t &out)
+    {
+        if (readRemaining() < 1) return false;
+        out = *readPtr();
+        tail_ += 1;
+        return true;
+    }
+
+    /**
+     * @brief Write one byte.
+     *
+     * @param[in] v Value to write.
+     * @return true if one byte was written; false if ring full.
+     */
+    bool writeUInt8(uint8_t v)
+    {
+        if (writeRemaining() < 1) return false;
+        *writePtr() = v;
+        head_ += 1;
+        return true;
+    }
+
+    //-------------------------------------------------------------------------
+    // 16-bit
+    //-------------------------------------------------------------------------
+    /**
+     * @brief Read a little-endian 16-bit value.
+     *
+     * @param[out] out Where the 16-bit value will be stored.
+     * @return true if two bytes were read; false if underflow.
+     */
+    bool readUInt16LE(uint16_t &out)
+    {
+        if (readRemaining() < 2) return false;
+        out = detail::loadUInt16LE(readPtr());
+        tail_ += 2;
+        return true;
+    }
+
+    /**
+     * @brief Read a big-endian 16-bit value.
+     *
+     * @param[out] out Where the 16-bit value will be stored.
+     * @return true if two bytes were read; false if underflow.
+     */
+    bool readUInt16BE(uint16_t &out)
+    {
+        if (readRemaining() < 2) return false;
+        out = detail::loadUInt16BE(readPtr());
+        tail_ += 2;
+        return true;
+    }
+
+    /**
+     * @brief Write a little-endian 16-bit value.
+     *
+     * @param[in] v Value to write.
+     * @return true if two bytes were written; false if overflow.
+     */
+    bool writeUInt16LE(uint16_t v)
+    {
+        if (writeRemaining() < 2) return false;
+        detail::storeUInt16LE(writePtr(), v);
+        head_ += 2;
+        return true;
+    }
+
+    /**
+     * @brief Write a big-endian 16-bit value.
+     *
+     * @param[in] v Value to write.
+     * @return true if two bytes were written; false if overflow.
+     */
+    bool writeUInt16BE(uint16_t v)
+    {
+        if (writeRemaining() < 2) return false;
+        detail::storeUInt16BE(writePtr(), v);
+        head_ += 2;
+        return true;
+    }
+
+    //-------------------------------------------------------------------------
+    // 32-bit
+    //-------------------------------------------------------------------------
+    /**
+     * @brief Read a little-endian 32-bit value.
+     *
+     * @param[out] out Where the 32-bit value will be stored.
+     * @return true if four bytes were read; false if underflow.
+     */
+    bool readUInt32LE(uint32_t &out)
+    {
+        if (readRemaining() < 4) return false;
+        out = detail::loadUInt32LE(readPtr());
+        tail_ += 4;
+        return true;
+    }
+
+    /**
+     * @brief Read a big-endian 32-bit value.
+     *
+     * @param[out] out Where the 32-bit value will be stored.
+     * @return true if four bytes were read; false if underflow.
+     */
+    bool readUInt32BE(uint32_t &out)
+    {
+        if (readRemaining() < 4) return false;
+        out = detail::loadUInt32BE(readPtr());
+        tail_ += 4;
+        return true;
+    }
+
+    /**
+     * @brief Write a little-endian 32-bit value.
+     *
+     * @param[in] v Value to write.
+     * @return true if four bytes were written; false if overflow.
+     */
+    bool writeUInt32LE(uint32_t v)
+    {
+        if (writeRemaining() < 4) return false;
+        detail::storeUInt32LE(writePtr(), v);
+        head_ += 4;
+        return true;
+    }
+
+    /**
+     * @brief Write a big-endian 32-bit value.
+     *
+     * @param[in] v Value to write.
+     * @return true if four bytes were written; false if overflow.
+     */
+    bool writeUInt32BE(uint32_t v)
+    {
+        if (writeRemaining() < 4) return false;
+        detail::storeUInt32BE(writePtr(), v);
+        head_ += 4;
+        return true;
+    }
+
+private:
+    /**
+     * @brief Reserve 2 * @p cap bytes of address space and map one memfd of
+     *        @p cap bytes into both halves. Leaves the ring invalid on failure.
+     */
+    void map(size_t cap)
+    {
+        const int fd = ::memfd_create("antBuffers.mirror", MFD_CLOEXEC);
+        if (fd < 0) return;
+        if (::ftruncate(fd, off_t(cap)) != 0) {
+            ::close(fd);
+            return;
+        }
+
+        void *base = ::mmap(nullptr, 2 * cap, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (base == MAP_FAILED) {
+            ::close(fd);
+            return;
+        }
+
+        uint8_t *lo = static_cast<uint8_t *>(base);
+        const bool ok =
+            ::mmap(lo, cap, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_FIXED, fd, 0) != MAP_FAILED &&
+            ::mmap(lo + cap, cap, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_FIXED, fd, 0) != MAP_FAILED;
+        ::close(fd);  // The mappings keep the memory alive.
+        if (!ok) {
+            ::munmap(base, 2 * cap);
+            return;
+        }
+
+        data_ = lo;
+        capacity_ = cap;
+        mask_ = cap - 1;
+    }
+
+    void unmap()
+    {
+        if (data_) ::munmap(data_, 2 * capacity_);
+        data_ = nullptr;
+        capacity_ = mask_ = head_ = tail_ = 0;
+    }
+
+    void take(MirroredByteRing &other)
+    {
+        data_ = other.data_;
+        capacity_ = other.capacity_;
+        mask_ = other.mask_;
+        head_ = other.head_;
+        tail_ = other.tail_;
+        other.data_ = nullptr;
+        other.capacity_ = other.mask_ = other.head_ = other.tail_ = 0;
+    }
+
+    uint8_t *data_     = nullptr; /**< Start of the first of the two mappings. */
+    size_t   capacity_ = 0;       /**< Size of one mapping in bytes. */
+    size_t   mask_     = 0;       /**< capacity_ - 1. */
+    size_t   head_     = 0;       /**< Free-running write cursor. */
+    size_t   tail_     = 0;       /**< Free-running read cursor. */
+};
+} // namespace antBuffers
+
+#endif // __linux__
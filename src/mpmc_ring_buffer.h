@@ -0,0 +1,245 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+
+#include "ring_detail.h"
+
+namespace antBuffers {
+/**
+ * @file mpmc_ring_buffer.h
+ * @brief Bounded lock-free multi-producer/multi-consumer ring buffer.
+ *
+ * Same push/pop contract as RingBuffer, safe to call from any number of
+ * producer and consumer threads concurrently.
+ */
+
+/**
+ * @brief Fixed-capacity, lock-free MPMC circular buffer.
+ *
+ * Every slot carries its own sequence number which tells producers and
+ * consumers whether the slot is ready for them at the current lap. A producer
+ * claims a position with a single CAS on the enqueue counter and then writes
+ * and publishes only its own slot; consumers do the same on the dequeue
+ * counter. Producers and consumers therefore never contend on a shared
+ * element count, and threads on the same side only contend on the claim.
+ *
+ * @tparam T Element type stored in the buffer. Must be MoveAssignable for move overload.
+ * @tparam N Compile-time capacity of the buffer. Must be a power of two.
+ */
+template<typename T, size_t N>
+class MpmcRingBuffer {
+    static_assert(detail::isPowerOfTwo(N), "MpmcRingBuffer capacity must be a power of two");
+
+public:
+    using value_type = T;  /**< Element type stored in the buffer. */
+
+    /**
+     * @brief Default constructor.
+     *
+     * Initializes an empty buffer; slot i starts ready for the producer at position i.
+     */
+    MpmcRingBuffer() {
+        for (size_t i = 0; i < N; ++i) {
+            cells_[i].seq.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    /**
+     * @brief Default destructor.
+     */
+    ~MpmcRingBuffer() = default;
+
+    MpmcRingBuffer(const MpmcRingBuffer &) = delete;
+    MpmcRingBuffer &operator=(const MpmcRingBuffer &) = delete;
+
+    /**
+     * @brief Push a copy of a value into the buffer.
+     *
+     * @param v Reference to the value to copy into the buffer.
+     * @return true if the value was successfully pushed; false if buffer is full.
+     */
+    bool push(const T &v) {
+        size_t pos;
+        Cell *cell = claimForPush(pos);
+        if (!cell) return false;
+        cell->value = v;
+        cell->seq.store(pos + 1, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * @brief Push a movable value into the buffer.
+     *
+     * @param v Rvalue reference to the value to move into the buffer.
+     * @return true if the value was successfully pushed; false if buffer is full.
+     */
+    bool push(T &&v) {
+        size_t pos;
+        Cell *cell = claimForPush(pos);
+        if (!cell) return false;
+        cell->value = std::move(v);
+        cell->seq.store(pos + 1, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * @brief Pop the oldest available element from the buffer.
+     *
+     * @param out Reference where the popped value will be stored.
+     * @return true if an element was successfully popped; false if buffer is empty.
+     */
+    bool pop(T &out) {
+        size_t pos;
+        Cell *cell = claimForPop(pos);
+        if (!cell) return false;
+        out = std::move(cell->value);
+        // Hand the slot back to producers one lap later.
+        cell->seq.store(pos + N, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * @brief Pop up to @p max of the oldest available elements into @p out.
+     *
+     * Counts the run of published slots at the dequeue position and claims
+     * all of it with a single CAS, so a batch costs one contended operation
+     * instead of one per element and is never interleaved with other pops.
+     *
+     * @param out Pointer to storage for at least @p max elements.
+     * @param max Maximum number of elements to pop.
+     * @return Number of elements popped (0 if buffer is empty).
+     */
+    size_t pop_bulk(T *out, size_t max) {
+        if (max > N) max = N;
+        size_t pos = dequeuePos_.value.load(std::memory_order_relaxed);
+        for (;;) {
+            size_t k = 0;
+            while (k < max && cells_[(pos + k) & (N - 1)].seq.load(std::memory_order_acquire) == pos + k + 1) ++k;
+            if (k == 0) {
+                const size_t seq = cells_[pos & (N - 1)].seq.load(std::memory_order_acquire);
+                if (intptr_t(seq) - intptr_t(pos + 1) < 0) return 0;  // Nothing published yet.
+                pos = dequeuePos_.value.load(std::memory_order_relaxed);
+                continue;
+            }
+            // Published slots stay published until their claimer releases
+            // them, so winning this CAS hands us the whole run.
+            if (dequeuePos_.value.compare_exchange_weak(pos, pos + k, std::memory_order_relaxed)) {
+                for (size_t i = 0; i < k; ++i) {
+                    Cell &cell = cells_[(pos + i) & (N - 1)];
+                    out[i] = std::move(cell.value);
+                    cell.seq.store(pos + i + N, std::memory_order_release);
+                }
+                return k;
+            }
+        }
+    }
+
+    /**
+     * @brief Get the current number of stored elements.
+     *
+     * @return Snapshot of the number of claimed-but-not-popped elements; only
+     *         exact when no other thread is operating on the buffer.
+     */
+    size_t size() const {
+        const size_t tail = dequeuePos_.value.load(std::memory_order_acquire);
+        const size_t head = enqueuePos_.value.load(std::memory_order_acquire);
+        const size_t n = head - tail;
+        // Counters are read separately, so racing operations can overshoot N.
+        return (n > N) ? N : n;
+    }
+
+    /**
+     * @brief Get the maximum capacity of the buffer.
+     *
+     * @return Compile-time maximum number of elements.
+     */
+    constexpr size_t capacity() const {
+        return N;
+    }
+
+    /**
+     * @brief Check if the buffer is empty.
+     *
+     * @return true if there are no elements stored; false otherwise.
+     */
+    bool empty() const {
+        return size() == 0;
+    }
+
+    /**
+     * @brief Check if the buffer is full.
+     *
+     * @return true if buffer has reached its capacity; false otherwise.
+     */
+    bool full() const {
+        return size() == N;
+    }
+
+private:
+    /** @brief A storage slot with its lap sequence number. */
+    struct Cell {
+        std::atomic<size_t> seq;  /**< Position this slot is ready for. */
+        T value;                  /**< Stored element. */
+    };
+
+    /** @brief A counter padded onto its own cache line. */
+    struct alignas(detail::cacheLineSize) PaddedCounter {
+        std::atomic<size_t> value{0};
+    };
+
+    /**
+     * @brief Claim the next producer position.
+     *
+     * @param[out] pos Claimed position, used to publish the cell afterwards.
+     * @return The claimed cell, or nullptr if the buffer is full.
+     */
+    Cell *claimForPush(size_t &pos) {
+        pos = enqueuePos_.value.load(std::memory_order_relaxed);
+        for (;;) {
+            Cell &cell = cells_[pos & (N - 1)];
+            const size_t seq = cell.seq.load(std::memory_order_acquire);
+            const intptr_t diff = intptr_t(seq) - intptr_t(pos);
+            if (diff == 0) {
+                if (enqueuePos_.value.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    return &cell;
+                }
+            } else if (diff < 0) {
+                return nullptr;  // Slot still holds last lap's element.
+            } else {
+                pos = enqueuePos_.value.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    /**
+     * @brief Claim the next consumer position.
+     *
+     * @param[out] pos Claimed position, used to release the cell afterwards.
+     * @return The claimed cell, or nullptr if the buffer is empty.
+     */
+    Cell *claimForPop(size_t &pos) {
+        pos = dequeuePos_.value.load(std::memory_order_relaxed);
+        for (;;) {
+            Cell &cell = cells_[pos & (N - 1)];
+            const size_t seq = cell.seq.load(std::memory_order_acquire);
+            const intptr_t diff = intptr_t(seq) - intptr_t(pos + 1);
+            if (diff == 0) {
+                if (dequeuePos_.value.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    return &cell;
+                }
+            } else if (diff < 0) {
+                return nullptr;  // Slot not yet published for this lap.
+            } else {
+                pos = dequeuePos_.value.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    PaddedCounter enqueuePos_;                        /**< Next producer position. */
+    PaddedCounter dequeuePos_;                        /**< Next consumer position. */
+    alignas(detail::cacheLineSize) Cell cells_[N];    /**< Slots with sequence numbers. */
+};
+} // namespace antBuffers
@@ -0,0 +1,212 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <initializer_list>
+#include <utility>
+
+#include "ring_detail.h"
+
+namespace antBuffers {
+/**
+ * @file multicast_ring.h
+ * @brief Disruptor-style broadcast ring: one producer, many consumers.
+ *
+ * Every consumer sees every element and reads it in place, so a frame that
+ * goes to several stages is stored once instead of being copied into one ring
+ * per stage.
+ */
+
+/**
+ * @brief Fixed-capacity broadcast ring with per-consumer cursors.
+ *
+ * Each consumer owns a cursor on its own cache line. The producer is gated
+ * only by the slowest consumer: it may not overwrite a slot until every
+ * consumer has released it. A consumer may also depend on other consumers
+ * (e.g. archive after decode) and then never gets ahead of them, which
+ * forms a pipeline over the same slots without copies.
+ *
+ * Register all consumers with addConsumer() before the producer starts.
+ * After that, push() may only be called from one producer thread and each
+ * consumer id may only be used from one thread at a time.
+ *
+ * @tparam T            Element type. Must be default-constructible and assignable,
+ *                      since slots are reused in place across laps.
+ * @tparam N            Capacity. Must be a power of two.
+ * @tparam MaxConsumers Maximum number of consumers that can be registered.
+ */
+template<typename T, size_t N, size_t MaxConsumers = 8>
+class MulticastRing {
+    static_assert(detail::isPowerOfTwo(N), "MulticastRing capacity must be a power of two");
+
+public:
+    using value_type = T;  /**< Element type stored in the ring. */
+
+    MulticastRing() = default;
+
+    MulticastRing(const MulticastRing &) = delete;
+    MulticastRing &operator=(const MulticastRing &) = delete;
+
+    //-------------------------------------------------------------------------
+    // Setup
+    //-------------------------------------------------------------------------
+    /**
+     * @brief Register a consumer that reads directly behind the producer.
+     *
+     * @return Consumer id, or -1 if MaxConsumers are already registered.
+     */
+    int addConsumer() {
+        return addConsumer({});
+    }
+
+    /**
+     * @brief Register a consumer that only sees an element after every
+     *        consumer in @p dependsOn has released it.
+     *
+     * @param dependsOn Ids returned by earlier addConsumer() calls.
+     * @return Consumer id, or -1 if MaxConsumers are already registered or a
+     *         dependency id is invalid.
+     */
+    int addConsumer(std::initializer_list<int> dependsOn) {
+        if (consumerCount_ == MaxConsumers) return -1;
+        Consumer &c = consumers_[consumerCount_];
+        c.depCount = 0;
+        for (int dep : dependsOn) {
+            if (dep < 0 || size_t(dep) >= consumerCount_ || c.depCount == MaxConsumers) return -1;
+            c.deps[c.depCount++] = &consumers_[dep].cursor;
+        }
+        c.cursor.store(producer_.head.load(std::memory_order_relaxed), std::memory_order_relaxed);
+        c.cachedLimit = c.cursor.load(std::memory_order_relaxed);
+        return int(consumerCount_++);
+    }
+
+    /** @brief Number of registered consumers. */
+    size_t consumers() const { return consumerCount_; }
+
+    //-------------------------------------------------------------------------
+    // Producer
+    //-------------------------------------------------------------------------
+    /**
+     * @brief Publish a copy of a value to every consumer (producer only).
+     *
+     * @return true if published; false if the slowest consumer is N behind.
+     */
+    bool push(const T &v) {
+        const size_t head = producer_.head.load(std::memory_order_relaxed);
+        if (!hasSpace(head)) return false;
+        buf_[head & (N - 1)] = v;
+        producer_.head.store(head + 1, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * @brief Publish a movable value to every consumer (producer only).
+     *
+     * @return true if published; false if the slowest consumer is N behind.
+     */
+    bool push(T &&v) {
+        const size_t head = producer_.head.load(std::memory_order_relaxed);
+        if (!hasSpace(head)) return false;
+        buf_[head & (N - 1)] = std::move(v);
+        producer_.head.store(head + 1, std::memory_order_release);
+        return true;
+    }
+
+    //-------------------------------------------------------------------------
+    // Consumers
+    //-------------------------------------------------------------------------
+    /**
+     * @brief Number of elements consumer @p id can read right now.
+     */
+    size_t available(int id) {
+        Consumer &c = consumers_[id];
+        c.cachedLimit = limitFor(c);
+        return c.cachedLimit - c.cursor.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Look at consumer @p id's next element in place.
+     *
+     * @param id Consumer id.
+     * @param k  Offset from the next element; must be < available(id).
+     * @return Reference into the ring, valid until the element is released.
+     */
+    const T &peek(int id, size_t k = 0) const {
+        return buf_[(consumers_[id].cursor.load(std::memory_order_relaxed) + k) & (N - 1)];
+    }
+
+    /**
+     * @brief Release @p k elements for consumer @p id, letting the producer
+     *        and any dependent consumers move on.
+     *
+     * @param k Number of elements to release; must be <= available(id).
+     */
+    void release(int id, size_t k = 1) {
+        Consumer &c = consumers_[id];
+        c.cursor.store(c.cursor.load(std::memory_order_relaxed) + k, std::memory_order_release);
+    }
+
+    /**
+     * @brief Copy out and release consumer @p id's next element.
+     *
+     * @return true if an element was read; false if none is available.
+     */
+    bool pop(int id, T &out) {
+        Consumer &c = consumers_[id];
+        // Only touch the shared cursors once the cached batch is used up.
+        if (c.cachedLimit == c.cursor.load(std::memory_order_relaxed) && available(id) == 0) return false;
+        out = peek(id);
+        release(id);
+        return true;
+    }
+
+    /** @brief Compile-time capacity of the ring. */
+    constexpr size_t capacity() const { return N; }
+
+private:
+    /** @brief Per-consumer state, on its own cache line. */
+    struct alignas(detail::cacheLineSize) Consumer {
+        std::atomic<size_t> cursor{0};                   /**< Next sequence to read. */
+        size_t cachedLimit = 0;                          /**< Last computed read limit. */
+        const std::atomic<size_t> *deps[MaxConsumers];   /**< Cursors this consumer trails. */
+        size_t depCount = 0;                             /**< Entries used in deps. */
+    };
+
+    /** @brief Producer state, on its own cache line. */
+    struct alignas(detail::cacheLineSize) ProducerSide {
+        std::atomic<size_t> head{0};  /**< Next sequence to publish. */
+        size_t cachedGate = 0;        /**< Last seen slowest consumer cursor. */
+    };
+
+    /**
+     * @brief Producer-side check for a free slot, recomputing the slowest
+     *        consumer only when the ring looks full.
+     */
+    bool hasSpace(size_t head) {
+        if (head - producer_.cachedGate < N) return true;
+        size_t gate = head;
+        for (size_t i = 0; i < consumerCount_; ++i) {
+            const size_t c = consumers_[i].cursor.load(std::memory_order_acquire);
+            if (head - c > head - gate) gate = c;
+        }
+        producer_.cachedGate = gate;
+        return head - gate < N;
+    }
+
+    /** @brief How far consumer @p c may read: the producer and all its dependencies. */
+    size_t limitFor(const Consumer &c) const {
+        size_t limit = producer_.head.load(std::memory_order_acquire);
+        const size_t cursor = c.cursor.load(std::memory_order_relaxed);
+        for (size_t i = 0; i < c.depCount; ++i) {
+            const size_t d = c.deps[i]->load(std::memory_order_acquire);
+            if (d - cursor < limit - cursor) limit = d;
+        }
+        return limit;
+    }
+
+    ProducerSide producer_;                        /**< Producer-owned cache line. */
+    Consumer     consumers_[MaxConsumers];         /**< One cache line per consumer. */
+    size_t       consumerCount_ = 0;               /**< Registered consumers. */
+    alignas(detail::cacheLineSize) T buf_[N];      /**< Slots shared by all consumers. */
+};
+} // namespace antBuffers
@@ -0,0 +1,195 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+#include "byte_codec.h"
+#include "varint_codec.h"
+
+namespace antBuffers {
+/**
+ * @file record_writer.h
+ * @brief Fluent record encoder with one bounds check per record and a sticky error flag.
+ *
+ * Every ByteBuffer write checks the remaining space and returns a bool, so a
+ * 12-field record costs 12 checks and 12 caller branches. A RecordWriter
+ * checks space once in ensure() for the whole record; its put* calls only
+ * test the sticky ok() flag, which the compiler folds into a single branch
+ * across an inlined chain of puts, leaving adjacent stores free to merge.
+ */
+
+/**
+ * @brief Sequential writer over a span reserved with ensure(), in the style of
+ *        an iostream failbit.
+ *
+ * Usage:
+ * @code
+ *   RecordWriter w = bb.beginRecord(11);
+ *   w.putUInt8(type).putUInt16BE(id).putUInt64LE(timestamp);
+ *   if (!bb.endRecord(w)) { ... }   // nothing was written
+ * @endcode
+ *
+ * put* calls do not check bounds: the bytes they write must be covered by
+ * earlier ensure() calls. If an ensure() fails, the writer enters the failed
+ * state and every later put is discarded. Obtained from ByteBuffer::beginRecord()
+ * and committed with ByteBuffer::endRecord(); nothing is visible in the
+ * buffer until then.
+ */
+class RecordWriter
+{
+public:
+    /**
+     * @brief Construct a writer over [begin, end).
+     *
+     * @param begin First byte to write.
+     * @param end   One past the last writable byte.
+     */
+    RecordWriter(uint8_t *begin, uint8_t *end)
+        : begin_(begin), cur_(begin), end_(end) {}
+
+    //-------------------------------------------------------------------------
+    // State
+    //-------------------------------------------------------------------------
+    /**
+     * @brief Check that @p n bytes are free from the current position.
+     *
+     * Covers the puts that follow. Sets the sticky failed state if fewer than
+     * @p n bytes remain; a failed writer stays failed.
+     *
+     * @return *this, for chaining.
+     */
+    RecordWriter &ensure(size_t n)
+    {
+        if (size_t(end_ - cur_) < n) ok_ = false;
+        return *this;
+    }
+
+    /** @brief false once any ensure() has failed. */
+    bool ok() const { return ok_; }
+
+    /** @brief Bytes written so far. */
+    size_t size() const { return size_t(cur_ - begin_); }
+
+    //-------------------------------------------------------------------------
+    // Unchecked puts
+    //-------------------------------------------------------------------------
+    /**
+     * @brief Write an integer or IEEE float in byte order @p E.
+     *
+     * @tparam V Integer or floating-point type of 1, 2, 4 or 8 bytes.
+     * @tparam E Byte order of the field.
+     * @return *this, for chaining.
+     */
+    template<typename V, Endian E>
+    RecordWriter &put(V v)
+    {
+        if (ok_) {
+            detail::store<V, E>(cur_, v);
+            cur_ += sizeof(V);
+        }
+        return *this;
+    }
+
+    /** @brief One byte. */
+    RecordWriter &putUInt8(uint8_t v) { return put<uint8_t, Endian::Little>(v); }
+
+    /** @brief One signed byte. */
+    RecordWriter &putInt8(int8_t v) { return put<int8_t, Endian::Little>(v); }
+
+    /** @brief Little-endian 16-bit value. */
+    RecordWriter &putUInt16LE(uint16_t v) { return put<uint16_t, Endian::Little>(v); }
+
+    /** @brief Big-endian 16-bit value. */
+    RecordWriter &putUInt16BE(uint16_t v) { return put<uint16_t, Endian::Big>(v); }
+
+    /** @brief Little-endian 32-bit value. */
+    RecordWriter &putUInt32LE(uint32_t v) { return put<uint32_t, Endian::Little>(v); }
+
+    /** @brief Big-endian 32-bit value. */
+    RecordWriter &putUInt32BE(uint32_t v) { return put<uint32_t, Endian::Big>(v); }
+
+    /** @brief Little-endian 64-bit value. */
+    RecordWriter &putUInt64LE(uint64_t v) { return put<uint64_t, Endian::Little>(v); }
+
+    /** @brief Big-endian 64-bit value. */
+    RecordWriter &putUInt64BE(uint64_t v) { return put<uint64_t, Endian::Big>(v); }
+
+    /** @brief Little-endian signed 16-bit value. */
+    RecordWriter &putInt16LE(int16_t v) { return put<int16_t, Endian::Little>(v); }
+
+    /** @brief Big-endian signed 16-bit value. */
+    RecordWriter &putInt16BE(int16_t v) { return put<int16_t, Endian::Big>(v); }
+
+    /** @brief Little-endian signed 32-bit value. */
+    RecordWriter &putInt32LE(int32_t v) { return put<int32_t, Endian::Little>(v); }
+
+    /** @brief Big-endian signed 32-bit value. */
+    RecordWriter &putInt32BE(int32_t v) { return put<int32_t, Endian::Big>(v); }
+
+    /** @brief Little-endian signed 64-bit value. */
+    RecordWriter &putInt64LE(int64_t v) { return put<int64_t, Endian::Little>(v); }
+
+    /** @brief Big-endian signed 64-bit value. */
+    RecordWriter &putInt64BE(int64_t v) { return put<int64_t, Endian::Big>(v); }
+
+    /** @brief Little-endian binary32. */
+    RecordWriter &putFloat32LE(float v) { return put<float, Endian::Little>(v); }
+
+    /** @brief Big-endian binary32. */
+    RecordWriter &putFloat32BE(float v) { return put<float, Endian::Big>(v); }
+
+    /** @brief Little-endian binary64. */
+    RecordWriter &putFloat64LE(double v) { return put<double, Endian::Little>(v); }
+
+    /** @brief Big-endian binary64. */
+    RecordWriter &putFloat64BE(double v) { return put<double, Endian::Big>(v); }
+
+    /** @brief Float narrowed to little-endian binary16 (2 bytes). */
+    RecordWriter &putFloat16LE(float v) { return put<uint16_t, Endian::Little>(detail::floatToHalf(v)); }
+
+    /** @brief Float narrowed to big-endian binary16 (2 bytes). */
+    RecordWriter &putFloat16BE(float v) { return put<uint16_t, Endian::Big>(detail::floatToHalf(v)); }
+
+    /**
+     * @brief Copy @p n raw bytes.
+     *
+     * @return *this, for chaining.
+     */
+    RecordWriter &putBytes(const uint8_t *src, size_t n)
+    {
+        if (ok_ && n) {
+            std::memcpy(cur_, src, n);
+            cur_ += n;
+        }
+        return *this;
+    }
+
+    /**
+     * @brief Write an unsigned LEB128 varint; reserve detail::varUIntSize(v)
+     *        bytes, or 10 for any value.
+     *
+     * @return *this, for chaining.
+     */
+    RecordWriter &putVarUInt(uint64_t v)
+    {
+        if (ok_) cur_ += detail::encodeVarUInt(cur_, v);
+        return *this;
+    }
+
+    /**
+     * @brief Write a ZigZag varint; same reservation rule as putVarUInt().
+     *
+     * @return *this, for chaining.
+     */
+    RecordWriter &putVarInt(int64_t v) { return putVarUInt(detail::zigZagEncode(v)); }
+
+private:
+    friend class ByteBuffer;
+
+    uint8_t *begin_;     /**< Start of the record. */
+    uint8_t *cur_;       /**< Next byte to write. */
+    uint8_t *end_;       /**< End of the writable region. */
+    bool     ok_ = true; /**< Sticky: cleared by a failed ensure(). */
+};
+} // namespace antBuffers
@@ -1,32 +1,90 @@
 #pragma once
 
 #include <cstddef>
+#include <cstring>
+#include <new>
+#include <optional>
+#include <type_traits>
 #include <utility>
+
+#include "ring_detail.h"
+#include "ring_stats.h"
+
 namespace antBuffers {
 /**
- * @brief Fixed-capacity, in-memory circular buffer (ring buffer) template.
+ * @brief A contiguous run of elements inside a ring's storage.
+ *
+ * @tparam T Element type (const-qualified for read-only runs).
+ */
+template<typename T>
+struct RingSpan {
+    T*     data = nullptr; /**< First element of the run. */
+    size_t size = 0;       /**< Number of elements in the run. */
+};
+
+/**
+ * @brief Up to two contiguous runs covering a region of a ring.
+ *
+ * @c second is non-empty only when the region wraps past the end of storage.
+ */
+template<typename T>
+struct RingSpans {
+    RingSpan<T> first;  /**< Run starting at the requested position. */
+    RingSpan<T> second; /**< Continuation from the start of storage. */
+
+    /** @brief Total number of elements across both runs. */
+    size_t size() const { return first.size + second.size; }
+};
+
+/**
+ * @brief Circular buffer algorithms shared by RingBuffer and RingBufferView.
  *
  * Provides non-blocking push and pop operations without dynamic allocation.
  * Ideal for embedded or real-time systems where predictability and minimal
  * overhead are required.
  *
- * @tparam T Element type stored in the buffer. Must be MoveAssignable for move overload.
- * @tparam N Compile-time capacity of the buffer (maximum number of elements).
+ * The buffer is driven by head/tail counters alone, with no separate element
+ * count. The Storage policy supplies the slots and the counter arithmetic:
+ * masked free-running counters for a power-of-two capacity, counters that
+ * wrap at 2N with a compare otherwise. Neither path divides.
+ *
+ * Slots are raw aligned storage: an element is constructed when it is pushed
+ * and destroyed when it is popped or cleared, so T need not be
+ * default-constructible and popped objects do not linger in the ring.
+ *
+ * @tparam T       Element type stored in the buffer. Must be MoveConstructible.
+ * @tparam Storage Slot storage and counter arithmetic (see ring_detail.h).
+ * @tparam Stats   Instrumentation policy (see ring_stats.h); NoRingStats
+ *                 compiles every hook away.
  */
-template<typename T, size_t N>
-class RingBuffer {
+template<typename T, typename Storage, typename Stats = NoRingStats>
+class BasicRingBuffer : private Stats {
 public:
+    using value_type = T;  /**< Element type stored in the buffer. */
+
     /**
-     * @brief Default constructor.
-     *
-     * Initializes an empty buffer.
+     * @brief Destructor. Destroys any elements still stored.
      */
-    RingBuffer() = default;
+    ~BasicRingBuffer() { clear(); }
 
     /**
-     * @brief Default destructor.
+     * @brief Construct a new element in place at the head of the buffer.
+     *
+     * @param args Arguments forwarded to T's constructor.
+     * @return true if the element was constructed; false if buffer is full.
      */
-    ~RingBuffer() = default;
+    template<typename... Args>
+    bool emplace(Args&&... args) {
+        if (full()) {
+            Stats::recordRejected(1);
+            return false;
+        }
+        ::new (static_cast<void*>(slot(store_.slot(head_)))) T(std::forward<Args>(args)...);
+        Stats::stampSlot(store_.slot(head_));
+        head_ = store_.advance(head_);
+        notePush(1);
+        return true;
+    }
 
     /**
      * @brief Push a copy of a value into the buffer.
@@ -35,11 +93,7 @@ public:
      * @return true if the value was successfully pushed; false if buffer is full.
      */
     bool push(const T& v) {
-        if (count_ == N) return false;
-        buf_[head_] = v;
-        head_ = (head_ + 1) % N;
-        ++count_;
-        return true;
+        return emplace(v);
     }
 
     /**
@@ -49,27 +103,187 @@ public:
      * @return true if the value was successfully pushed; false if buffer is full.
      */
     bool push(T&& v) {
-        if (count_ == N) return false;
-        buf_[head_] = std::move(v);
-        head_ = (head_ + 1) % N;
-        ++count_;
-        return true;
+        return emplace(std::move(v));
+    }
+
+    /**
+     * @brief Push a copy of a value, dropping the oldest element if full.
+     *
+     * Never fails: when the buffer is full the oldest element is destroyed
+     * and the tail advanced in the same step. Drops are reported to the
+     * Stats policy, e.g. RingStats::snapshot().dropped. A zero-capacity
+     * view has no slot to overwrite, so the push is rejected instead.
+     *
+     * @param v Reference to the value to copy into the buffer.
+     * @return true if the oldest element was dropped to make room; false otherwise.
+     */
+    bool push_overwrite(const T& v) {
+        if (capacity() == 0) {
+            Stats::recordRejected(1);
+            return false;
+        }
+        const bool drop = dropOldestIfFull();
+        emplace(v);
+        return drop;
+    }
+
+    /**
+     * @brief Push a movable value, dropping the oldest element if full.
+     *
+     * @param v Rvalue reference to the value to move into the buffer.
+     * @return true if the oldest element was dropped to make room; false otherwise.
+     */
+    bool push_overwrite(T&& v) {
+        if (capacity() == 0) {
+            Stats::recordRejected(1);
+            return false;
+        }
+        const bool drop = dropOldestIfFull();
+        emplace(std::move(v));
+        return drop;
     }
 
     /**
      * @brief Pop the oldest element from the buffer.
      *
-     * Moves the oldest element into the provided output reference.
+     * Moves the oldest element into the provided output reference and
+     * destroys it in the ring.
      *
      * @param out Reference where the popped value will be stored.
      * @return true if an element was successfully popped; false if buffer is empty.
      */
     bool pop(T& out) {
-        if (count_ == 0) return false;
-        out = std::move(buf_[tail_]);
-        tail_ = (tail_ + 1) % N;
-        --count_;
-        return true;
+        return popOne([&](T& oldest) { out = std::move(oldest); });
+    }
+
+    /**
+     * @brief Pop the oldest element into an optional.
+     *
+     * For element types without a default constructor, where the caller has
+     * no object to move-assign into. @p out is left unchanged if empty.
+     *
+     * @param out Optional that receives the popped value.
+     * @return true if an element was successfully popped; false if buffer is empty.
+     */
+    bool pop(std::optional<T>& out) {
+        return popOne([&](T& oldest) { out.emplace(std::move(oldest)); });
+    }
+
+    /**
+     * @brief Push up to @p n elements copied from @p src.
+     *
+     * Copies as many elements as fit, in order, and updates the head once.
+     * Trivially copyable types are moved with at most two memcpy calls, one
+     * per contiguous segment around the wrap point.
+     *
+     * @param src Pointer to the elements to copy into the buffer.
+     * @param n   Number of elements available at @p src.
+     * @return Number of elements actually pushed (0 if buffer is full).
+     */
+    size_t push_bulk(const T* src, size_t n) {
+        const size_t free = capacity() - size();
+        if (n > free) {
+            Stats::recordRejected(n - free);
+            n = free;
+        }
+        if (n == 0) return 0;
+        const size_t start = store_.slot(head_);
+        const size_t first = (n < capacity() - start) ? n : capacity() - start;
+        copyIn(slot(start), src, first);
+        copyIn(slot(0), src + first, n - first);
+        stampSlots(head_, n);
+        head_ = store_.advance(head_, n);
+        notePush(n);
+        return n;
+    }
+
+    /**
+     * @brief Pop up to @p n of the oldest elements into @p dst.
+     *
+     * Moves as many elements as are stored, in order, and updates the tail
+     * once. Trivially copyable types are moved with at most two memcpy calls;
+     * other types are move-assigned into @p dst and destroyed in the ring.
+     *
+     * @param dst Pointer to storage for at least @p n elements.
+     * @param n   Maximum number of elements to pop.
+     * @return Number of elements actually popped (0 if buffer is empty).
+     */
+    size_t pop_bulk(T* dst, size_t n) {
+        const size_t used = size();
+        if (n > used) n = used;
+        if (n == 0) {
+            if (used == 0) Stats::recordFailedPop();
+            return 0;
+        }
+        const size_t start = store_.slot(tail_);
+        const size_t first = (n < capacity() - start) ? n : capacity() - start;
+        moveOut(dst, slot(start), first);
+        moveOut(dst + first, slot(0), n - first);
+        recordResidencies(n);
+        tail_ = store_.advance(tail_, n);
+        Stats::recordPop(n);
+        return n;
+    }
+
+    /**
+     * @brief Expose free slots for the caller to fill in place.
+     *
+     * Returns up to @p n writable slots starting at the head, split into at
+     * most two runs around the wrap point. Nothing becomes visible to pop()
+     * until commit() is called. Only available for trivially copyable T,
+     * since the slots are uninitialized storage.
+     *
+     * @param n Number of slots wanted.
+     * @return Writable runs totalling min(n, free slots) elements.
+     */
+    RingSpans<T> reserve(size_t n) {
+        static_assert(std::is_trivially_copyable<T>::value,
+                      "reserve()/commit() require a trivially copyable T");
+        const size_t free = capacity() - size();
+        if (n > free) n = free;
+        return split(slot(0), store_.slot(head_), n);
+    }
+
+    /**
+     * @brief Publish @p k slots previously obtained from reserve().
+     *
+     * @param k Number of slots written, at most the size of the last reserve().
+     */
+    void commit(size_t k) {
+        static_assert(std::is_trivially_copyable<T>::value,
+                      "reserve()/commit() require a trivially copyable T");
+        stampSlots(head_, k);
+        head_ = store_.advance(head_, k);
+        if (k) notePush(k);
+    }
+
+    /**
+     * @brief Expose every stored element for in-place reading.
+     *
+     * @return Read-only runs covering the stored elements, oldest first.
+     */
+    RingSpans<const T> peek_spans() const {
+        return split(slot(0), store_.slot(tail_), size());
+    }
+
+    /**
+     * @brief Drop the @p k oldest elements after reading them in place.
+     *
+     * @param k Number of elements to release; clamped to size().
+     */
+    void consume(size_t k) {
+        const size_t used = size();
+        if (k > used) k = used;
+        recordResidencies(k);
+        if constexpr (!std::is_trivially_destructible<T>::value) {
+            for (size_t i = 0; i < k; ++i) {
+                slot(store_.slot(tail_))->~T();
+                tail_ = store_.advance(tail_);
+            }
+        } else {
+            tail_ = store_.advance(tail_, k);
+        }
+        if (k) Stats::recordPop(k);
     }
 
     /**
@@ -78,16 +292,16 @@ public:
      * @return Number of elements currently in the buffer.
      */
     size_t size() const {
-        return count_;
+        return store_.distance(head_, tail_);
     }
 
     /**
      * @brief Get the maximum capacity of the buffer.
      *
-     * @return Compile-time maximum number of elements.
+     * @return Maximum number of elements.
      */
     constexpr size_t capacity() const {
-        return N;
+        return store_.capacity();
     }
 
     /**
@@ -96,7 +310,7 @@ public:
      * @return true if there are no elements stored; false otherwise.
      */
     bool empty() const {
-        return count_ == 0;
+        return head_ == tail_;
     }
 
     /**
@@ -105,23 +319,238 @@ public:
      * @return true if buffer has reached its capacity; false otherwise.
      */
     bool full() const {
-        return count_ == N;
+        return size() == capacity();
+    }
+
+    /**
+     * @brief Instrumentation counters, e.g. stats().snapshot() with RingStats.
+     */
+    const Stats& stats() const {
+        return *this;
+    }
+
+    /**
+     * @brief Mutable access to the instrumentation, e.g. to reset() it.
+     */
+    Stats& stats() {
+        return *this;
     }
 
     /**
      * @brief Clear all contents of the buffer.
      *
-     * Resets head, tail, and count to zero. Does not destruct stored elements,
-     * they will be overwritten on subsequent pushes.
+     * Destroys every stored element, then resets head and tail to zero.
      */
     void clear() {
-        head_ = tail_ = count_ = 0;
+        if constexpr (!std::is_trivially_destructible<T>::value) {
+            for (size_t i = tail_; i != head_; i = store_.advance(i)) {
+                slot(store_.slot(i))->~T();
+            }
+        }
+        head_ = tail_ = 0;
+    }
+
+protected:
+    /** @brief Construct an empty buffer over the given storage. */
+    template<typename... StorageArgs>
+    explicit BasicRingBuffer(StorageArgs&&... args) : store_(std::forward<StorageArgs>(args)...) {}
+
+    /** @brief Append copies of @p other's elements (this buffer must be empty). */
+    void copyFrom(const BasicRingBuffer& other) {
+        for (size_t i = other.tail_; i != other.head_; i = store_.advance(i)) {
+            emplace(*other.slot(store_.slot(i)));
+        }
+    }
+
+    /** @brief Take @p other's elements (this buffer must be empty), leaving it empty. */
+    void moveFrom(BasicRingBuffer& other) {
+        for (size_t i = other.tail_; i != other.head_; i = store_.advance(i)) {
+            emplace(std::move(*other.slot(store_.slot(i))));
+        }
+        other.clear();
     }
 
 private:
-    T      buf_[N];   /**< Internal storage array of size N. */
-    size_t head_  = 0;/**< Index for next push. */
-    size_t tail_  = 0;/**< Index for next pop. */
-    size_t count_ = 0;/**< Current number of elements. */
+    /** @brief Pointer to storage slot @p i (which may not hold a live object). */
+    T* slot(size_t i) {
+        return store_.data() + i;
+    }
+
+    const T* slot(size_t i) const {
+        return store_.data() + i;
+    }
+
+    /** @brief Report @p n pushed elements and the resulting occupancy to Stats. */
+    void notePush(size_t n) {
+        if constexpr (Stats::enabled) Stats::recordPush(n, size(), capacity());
+    }
+
+    /** @brief Stamp the @p n slots starting at counter @p from as just filled. */
+    void stampSlots(size_t from, size_t n) {
+        if constexpr (Stats::timesSlots) {
+            for (size_t i = 0; i < n; ++i, from = store_.advance(from)) Stats::stampSlot(store_.slot(from));
+        }
+    }
+
+    /** @brief Record residency for the @p n oldest slots, before the tail moves past them. */
+    void recordResidencies(size_t n) {
+        if constexpr (Stats::timesSlots) {
+            size_t at = tail_;
+            for (size_t i = 0; i < n; ++i, at = store_.advance(at)) Stats::recordResidency(store_.slot(at));
+        }
+    }
+
+    /** @brief Hand the oldest element to @p sink, then destroy it and advance the tail. */
+    template<typename Sink>
+    bool popOne(Sink&& sink) {
+        if (empty()) {
+            Stats::recordFailedPop();
+            return false;
+        }
+        T* p = slot(store_.slot(tail_));
+        sink(*p);
+        p->~T();
+        Stats::recordResidency(store_.slot(tail_));
+        tail_ = store_.advance(tail_);
+        Stats::recordPop(1);
+        return true;
+    }
+
+    /** @brief Destroy the oldest element and advance the tail if the buffer is full. */
+    bool dropOldestIfFull() {
+        if (!full()) return false;
+        slot(store_.slot(tail_))->~T();
+        tail_ = store_.advance(tail_);
+        Stats::recordDrop(1);
+        return true;
+    }
+
+    /** @brief Split @p n slots of @p base starting at index @p start into runs. */
+    template<typename U>
+    RingSpans<U> split(U* base, size_t start, size_t n) const {
+        const size_t first = (n < capacity() - start) ? n : capacity() - start;
+        return {{base + start, first}, {base, n - first}};
+    }
+
+    /** @brief Copy-construct @p n contiguous elements into empty ring slots. */
+    static void copyIn(T* dst, const T* src, size_t n) {
+        if constexpr (std::is_trivially_copyable<T>::value) {
+            if (n) std::memcpy(dst, src, n * sizeof(T));
+        } else {
+            for (size_t i = 0; i < n; ++i) ::new (static_cast<void*>(dst + i)) T(src[i]);
+        }
+    }
+
+    /** @brief Move @p n contiguous elements out of ring slots and destroy them. */
+    static void moveOut(T* dst, T* src, size_t n) {
+        if constexpr (std::is_trivially_copyable<T>::value) {
+            if (n) std::memcpy(dst, src, n * sizeof(T));
+        } else {
+            for (size_t i = 0; i < n; ++i) {
+                dst[i] = std::move(src[i]);
+                src[i].~T();
+            }
+        }
+    }
+
+    Storage store_;       /**< Slots and counter arithmetic. */
+    size_t head_  = 0;/**< Counter of the next slot to push. */
+    size_t tail_  = 0;/**< Counter of the next slot to pop. */
 };
+
+/**
+ * @brief Fixed-capacity, in-memory circular buffer (ring buffer) template.
+ *
+ * Slots are held inline. When N is a power of two the counters run freely
+ * and are masked; otherwise they wrap at 2N with a compare.
+ *
+ * @tparam T     Element type stored in the buffer. Must be MoveConstructible.
+ * @tparam N     Compile-time capacity of the buffer (maximum number of elements).
+ * @tparam Stats Instrumentation policy, e.g. RingStats<> (see ring_stats.h).
+ */
+template<typename T, size_t N, typename Stats = NoRingStats>
+class RingBuffer : public BasicRingBuffer<T, detail::FixedRingStorage<T, N>, Stats> {
+    static_assert(statsFitCapacity<Stats>(N), "ResidencyStats<Capacity> must match the ring's N");
+
+    using Base = BasicRingBuffer<T, detail::FixedRingStorage<T, N>, Stats>;
+
+public:
+    /**
+     * @brief Default constructor.
+     *
+     * Initializes an empty buffer.
+     */
+    RingBuffer() = default;
+
+    /**
+     * @brief Copy constructor. Copies the stored elements in FIFO order.
+     */
+    RingBuffer(const RingBuffer& other) : Base() { this->copyFrom(other); }
+
+    /**
+     * @brief Move constructor. Moves the stored elements and empties @p other.
+     */
+    RingBuffer(RingBuffer&& other) : Base() { this->moveFrom(other); }
+
+    RingBuffer& operator=(const RingBuffer& other) {
+        if (this != &other) { this->clear(); this->copyFrom(other); }
+        return *this;
+    }
+
+    RingBuffer& operator=(RingBuffer&& other) {
+        if (this != &other) { this->clear(); this->moveFrom(other); }
+        return *this;
+    }
+};
+
+/**
+ * @brief Circular buffer over caller-provided storage with a runtime capacity.
+ *
+ * Same operations as RingBuffer, but sized at run time, e.g. from
+ * configuration or to live in huge pages or a shared arena. The capacity is
+ * the largest power of two that fits in the storage, so indices are always
+ * masked. The view owns the elements it constructs but not the memory, which
+ * must outlive it and be suitably aligned for T.
+ *
+ * @tparam T     Element type stored in the buffer. Must be MoveConstructible.
+ * @tparam Stats Instrumentation policy, e.g. RingStats<> (see ring_stats.h).
+ */
+template<typename T, typename Stats = NoRingStats>
+class RingBufferView : public BasicRingBuffer<T, detail::ViewRingStorage<T>, Stats> {
+    static_assert(!Stats::timesSlots, "ResidencyStats needs a compile-time capacity; use RingBuffer");
+
+    using Base = BasicRingBuffer<T, detail::ViewRingStorage<T>, Stats>;
+
+public:
+    /**
+     * @brief Construct an empty ring over an existing array.
+     *
+     * @param storage     Memory for at least @p maxElements objects of type T.
+     * @param maxElements Number of elements the memory can hold; capacity()
+     *                    is this rounded down to a power of two.
+     */
+    RingBufferView(void* storage, size_t maxElements) : Base(storage, maxElements) {}
+
+    RingBufferView(const RingBufferView&) = delete;
+    RingBufferView& operator=(const RingBufferView&) = delete;
+
+    /**
+     * @brief Bytes of storage needed for a capacity of at least @p minElements.
+     */
+    static constexpr size_t storageBytes(size_t minElements) {
+        return detail::nextPowerOfTwo(minElements) * sizeof(T);
+    }
+};
+
+/**
+ * @brief RingBuffer whose capacity is rounded up to a power of two.
+ *
+ * Holds at least MinN elements and always takes the masked index path.
+ *
+ * @tparam T     Element type stored in the buffer.
+ * @tparam MinN  Minimum number of elements the buffer must hold.
+ * @tparam Stats Instrumentation policy, e.g. RingStats<> (see ring_stats.h).
+ */
+template<typename T, size_t MinN, typename Stats = NoRingStats>
+using Pow2RingBuffer = RingBuffer<T, detail::nextPowerOfTwo(MinN), Stats>;
 }; // namespace antBuffers
\ No newline at end of file
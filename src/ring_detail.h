@@ -0,0 +1,237 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+#if defined(__linux__)
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+namespace antBuffers {
+namespace detail {
+/**
+ * @file ring_detail.h
+ * @brief Internal helpers shared by the ring buffer family.
+ *
+ * Not part of the public API; names and layout may change between releases.
+ */
+
+/**
+ * @brief Assumed size of a cache line in bytes.
+ *
+ * Used to keep producer- and consumer-owned state apart so the two sides of a
+ * concurrent ring do not invalidate each other's lines on every operation.
+ */
+constexpr size_t cacheLineSize = 64;
+
+/**
+ * @brief Hint to the CPU that the caller is spinning on shared state.
+ *
+ * Lowers power and yields pipeline resources to a sibling hyper-thread; a
+ * no-op on targets without such an instruction.
+ */
+inline void cpuRelax() {
+#if defined(__x86_64__) || defined(__i386__)
+    __builtin_ia32_pause();
+#elif defined(__aarch64__) || defined(__arm__)
+    __asm__ __volatile__("yield");
+#endif
+}
+
+/**
+ * @brief Pin the calling thread to one CPU (Linux only).
+ *
+ * Keeps a thread's ring state in one core's cache; used by ShardedRingPool
+ * workers and the benchmark harness.
+ *
+ * @return true if the affinity was set; false on error or unsupported platforms.
+ */
+inline bool pinCurrentThread(size_t cpu) {
+#if defined(__linux__)
+    if (cpu >= CPU_SETSIZE) return false;
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    CPU_SET(cpu, &set);
+    return ::pthread_setaffinity_np(::pthread_self(), sizeof(set), &set) == 0;
+#else
+    (void)cpu;
+    return false;
+#endif
+}
+
+/**
+ * @brief Check whether a value is a non-zero power of two.
+ */
+constexpr bool isPowerOfTwo(size_t n) { return n != 0 && (n & (n - 1)) == 0; }
+
+/**
+ * @brief Smallest power of two that is >= @p n (1 for n == 0).
+ */
+constexpr size_t nextPowerOfTwo(size_t n) {
+    size_t p = 1;
+    while (p < n) p <<= 1;
+    return p;
+}
+
+/**
+ * @brief Largest power of two that is <= @p n (0 for n == 0).
+ */
+constexpr size_t prevPowerOfTwo(size_t n) {
+    if (n == 0) return 0;
+    size_t p = 1;
+    while (p <= n / 2) p <<= 1;
+    return p;
+}
+
+/**
+ * @brief Index arithmetic for a ring of N slots driven by head/tail counters.
+ *
+ * Counters never need a separate element count: full and empty are told apart
+ * because the counters run over a range larger than N. For a general N they
+ * wrap at 2N, which also keeps them correct on targets with a 32-bit size_t.
+ *
+ * @tparam N Number of slots in the ring.
+ */
+template<size_t N, bool Pow2 = isPowerOfTwo(N)>
+struct RingCounter {
+    static_assert(N > 0, "ring capacity must be non-zero");
+
+    /** @brief Counter value after advancing @p i by @p k (k <= N). */
+    static constexpr size_t advance(size_t i, size_t k = 1) {
+        i += k;
+        return (i >= 2 * N) ? i - 2 * N : i;
+    }
+
+    /** @brief Storage slot addressed by counter @p i. */
+    static constexpr size_t slot(size_t i) { return (i >= N) ? i - N : i; }
+
+    /** @brief Number of elements between @p tail and @p head. */
+    static constexpr size_t distance(size_t head, size_t tail) {
+        return (head >= tail) ? head - tail : head + 2 * N - tail;
+    }
+};
+
+/**
+ * @brief Power-of-two specialization: counters run freely and are masked.
+ *
+ * Unsigned wrap-around at the top of size_t is harmless because N divides it.
+ */
+template<size_t N>
+struct RingCounter<N, true> {
+    static constexpr size_t advance(size_t i, size_t k = 1) { return i + k; }
+    static constexpr size_t slot(size_t i) { return i & (N - 1); }
+    static constexpr size_t distance(size_t head, size_t tail) { return head - tail; }
+};
+
+/**
+ * @brief Index arithmetic with 64-bit counters that never wrap in practice.
+ *
+ * For rings where a counter can be compared against a stale copy of itself,
+ * such as a tail that both sides CAS: a counter that wraps at 2N lets a stale
+ * value match again after the other side advances a multiple of 2N. 64-bit
+ * counters take centuries to wrap. slot() is a modulo, which compiles to a
+ * mask for a power-of-two N.
+ *
+ * @tparam N Number of slots in the ring.
+ */
+template<size_t N>
+struct FreeRunningCounter {
+    static_assert(N > 0, "ring capacity must be non-zero");
+
+    static constexpr uint64_t advance(uint64_t i, size_t k = 1) { return i + k; }
+    static constexpr size_t slot(uint64_t i) { return size_t(i % N); }
+    static constexpr uint64_t distance(uint64_t head, uint64_t tail) { return head - tail; }
+};
+
+/**
+ * @brief A trivially copyable T held as relaxed atomic words.
+ *
+ * For slots one thread may overwrite while another copies them out, with a
+ * CAS deciding afterwards whether the copy is kept. Plain accesses would be a
+ * data race; relaxed per-word atomics make it well defined, and a torn copy
+ * is only ever discarded. The widest word dividing sizeof(T) is used, so an
+ * 8-byte T is a single load or store.
+ *
+ * @tparam T Element type; must be trivially copyable.
+ */
+template<typename T>
+struct AtomicWords {
+    static_assert(std::is_trivially_copyable<T>::value, "AtomicWords requires a trivially copyable T");
+
+    using Word = std::conditional_t<sizeof(T) % 8 == 0, uint64_t,
+                 std::conditional_t<sizeof(T) % 4 == 0, uint32_t,
+                 std::conditional_t<sizeof(T) % 2 == 0, uint16_t, uint8_t>>>;
+    static constexpr size_t count = sizeof(T) / sizeof(Word);
+
+    void store(const T &v) {
+        Word w[count];
+        std::memcpy(w, &v, sizeof(T));
+        for (size_t i = 0; i < count; ++i) words[i].store(w[i], std::memory_order_relaxed);
+    }
+
+    /** @brief Copy the value's bytes to @p dst, which need not hold a live T. */
+    void load(void *dst) const {
+        Word w[count];
+        for (size_t i = 0; i < count; ++i) w[i] = words[i].load(std::memory_order_relaxed);
+        std::memcpy(dst, w, sizeof(T));
+    }
+
+    std::atomic<Word> words[count];  /**< The value's bytes, word by word. */
+};
+
+/**
+ * @brief Slot storage held inline, for a capacity fixed at compile time.
+ *
+ * Counter arithmetic comes from RingCounter<N>, so the general and the
+ * power-of-two paths are both resolved at compile time.
+ */
+template<typename T, size_t N>
+struct FixedRingStorage {
+    using Counter = RingCounter<N>;
+
+    /** @brief Leaves the slots uninitialized (no zero-fill on value-init). */
+    FixedRingStorage() {}
+
+    T *data() { return reinterpret_cast<T *>(bytes_); }
+    const T *data() const { return reinterpret_cast<const T *>(bytes_); }
+
+    static constexpr size_t capacity() { return N; }
+    static constexpr size_t advance(size_t i, size_t k = 1) { return Counter::advance(i, k); }
+    static constexpr size_t slot(size_t i) { return Counter::slot(i); }
+    static constexpr size_t distance(size_t head, size_t tail) { return Counter::distance(head, tail); }
+
+    alignas(T) unsigned char bytes_[N * sizeof(T)];  /**< Raw storage for N elements. */
+};
+
+/**
+ * @brief Slot storage provided by the caller, with a runtime capacity.
+ *
+ * The capacity is the largest power of two that fits, so counters always
+ * run freely and are masked.
+ */
+template<typename T>
+struct ViewRingStorage {
+    ViewRingStorage(void *storage, size_t maxElements)
+        : data_(static_cast<T *>(storage)),
+          capacity_(prevPowerOfTwo(maxElements)),
+          mask_(capacity_ - 1) {}
+
+    T *data() { return data_; }
+    const T *data() const { return data_; }
+
+    size_t capacity() const { return capacity_; }
+    static size_t advance(size_t i, size_t k = 1) { return i + k; }
+    size_t slot(size_t i) const { return i & mask_; }
+    static size_t distance(size_t head, size_t tail) { return head - tail; }
+
+    T     *data_;      /**< Caller-provided slot array. */
+    size_t capacity_;  /**< Usable slots, a power of two (or 0). */
+    size_t mask_;      /**< capacity_ - 1. */
+};
+
+} // namespace detail
+} // namespace antBuffers
@@ -0,0 +1,251 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+
+#include "latency_histogram.h"
+#include "ring_detail.h"
+
+namespace antBuffers {
+/**
+ * @file ring_stats.h
+ * @brief Opt-in occupancy and drop counters for the ring buffers.
+ *
+ * Rings take a Stats policy as their last template parameter. The default,
+ * NoRingStats, has empty hooks and no state, so an uninstrumented ring is
+ * unchanged in size and code. RingStats counts pushes, pops, rejections,
+ * overwrite drops and the high-water mark so a backed-up pipeline stage can be identified.
+ * ResidencyStats times how long each element sits in the ring.
+ */
+
+/**
+ * @brief Point-in-time copy of a ring's RingStats counters.
+ *
+ * @tparam Buckets Number of occupancy histogram buckets (0 = no histogram).
+ */
+template<size_t Buckets>
+struct RingStatsSnapshot {
+    uint64_t pushes         = 0;  /**< Elements pushed successfully. */
+    uint64_t pops           = 0;  /**< Elements popped or consumed. */
+    uint64_t rejectedPushes = 0;  /**< Elements refused because the ring was full. */
+    uint64_t dropped        = 0;  /**< Oldest elements discarded by push_overwrite(). */
+    uint64_t failedPops     = 0;  /**< Pop calls that found the ring empty. */
+    uint64_t highWater      = 0;  /**< Largest occupancy seen after a push. */
+    /**
+     * Occupancy after each push; bucket i covers occupancies in
+     * [i * (capacity + 1) / Buckets, (i + 1) * (capacity + 1) / Buckets).
+     */
+    std::array<uint64_t, Buckets> histogram{};
+};
+
+/**
+ * @brief Stats policy that records nothing; every hook compiles away.
+ */
+struct NoRingStats {
+    static constexpr bool enabled = false;     /**< Whether the counter hooks record anything. */
+    static constexpr bool timesSlots = false;  /**< Whether the slot hooks record anything. */
+    static constexpr size_t stampedSlots = 0;  /**< Slots the slot hooks index; 0 if unused. */
+
+    void recordPush(size_t, size_t, size_t) {}
+    void recordRejected(size_t) {}
+    void recordDrop(size_t) {}
+    void recordPop(size_t) {}
+    void recordFailedPop() {}
+    void stampSlot(size_t) {}
+    void recordResidency(size_t) {}
+};
+
+/**
+ * @brief Stats policy with relaxed atomic counters.
+ *
+ * Producer-side and consumer-side counters live on separate cache lines, and
+ * each side only writes its own, so instrumenting an SPSC ring adds no
+ * cross-core traffic. Every counter has a single writer and is updated with a
+ * relaxed load and store rather than a read-modify-write. snapshot() may be
+ * called from any thread, e.g. a metrics exporter; its fields are read
+ * individually and are not a consistent cut across both sides.
+ *
+ * @tparam Buckets Number of occupancy histogram buckets (0 = no histogram).
+ */
+template<size_t Buckets = 0>
+class RingStats {
+public:
+    static constexpr bool enabled = true;      /**< Whether the counter hooks record anything. */
+    static constexpr bool timesSlots = false;  /**< Whether the slot hooks record anything. */
+    static constexpr size_t stampedSlots = 0;  /**< Slots the slot hooks index; 0 if unused. */
+
+    using Snapshot = RingStatsSnapshot<Buckets>;  /**< Type returned by snapshot(). */
+
+    /**
+     * @brief Producer hook: @p n elements were pushed, leaving @p size of @p capacity used.
+     */
+    void recordPush(size_t n, size_t size, size_t capacity) {
+        bump(producer_.pushes, n);
+        if (size > producer_.highWater.load(std::memory_order_relaxed)) {
+            producer_.highWater.store(size, std::memory_order_relaxed);
+        }
+        if constexpr (Buckets != 0) {
+            bump(producer_.histogram[size * Buckets / (capacity + 1)], 1);
+        } else {
+            (void)capacity;
+        }
+    }
+
+    /** @brief Producer hook: @p n elements were refused because the ring was full. */
+    void recordRejected(size_t n) { bump(producer_.rejected, n); }
+
+    /** @brief Producer hook: @p n of the oldest elements were discarded to make room. */
+    void recordDrop(size_t n) { bump(producer_.dropped, n); }
+
+    /** @brief Consumer hook: @p n elements were popped. */
+    void recordPop(size_t n) { bump(consumer_.pops, n); }
+
+    /** @brief Consumer hook: a pop found the ring empty. */
+    void recordFailedPop() { bump(consumer_.failedPops, 1); }
+
+    void stampSlot(size_t) {}
+    void recordResidency(size_t) {}
+
+    /**
+     * @brief Copy the current counter values.
+     */
+    Snapshot snapshot() const {
+        Snapshot s;
+        s.pushes         = producer_.pushes.load(std::memory_order_relaxed);
+        s.rejectedPushes = producer_.rejected.load(std::memory_order_relaxed);
+        s.dropped        = producer_.dropped.load(std::memory_order_relaxed);
+        s.highWater      = producer_.highWater.load(std::memory_order_relaxed);
+        s.pops           = consumer_.pops.load(std::memory_order_relaxed);
+        s.failedPops     = consumer_.failedPops.load(std::memory_order_relaxed);
+        for (size_t i = 0; i < Buckets; ++i) {
+            s.histogram[i] = producer_.histogram[i].load(std::memory_order_relaxed);
+        }
+        return s;
+    }
+
+    /**
+     * @brief Zero every counter. Not atomic with respect to concurrent updates.
+     */
+    void reset() {
+        producer_.pushes.store(0, std::memory_order_relaxed);
+        producer_.rejected.store(0, std::memory_order_relaxed);
+        producer_.dropped.store(0, std::memory_order_relaxed);
+        producer_.highWater.store(0, std::memory_order_relaxed);
+        for (auto &b : producer_.histogram) b.store(0, std::memory_order_relaxed);
+        consumer_.pops.store(0, std::memory_order_relaxed);
+        consumer_.failedPops.store(0, std::memory_order_relaxed);
+    }
+
+private:
+    /** @brief Single-writer increment: no locked instruction needed. */
+    static void bump(std::atomic<uint64_t> &c, size_t n) {
+        c.store(c.load(std::memory_order_relaxed) + n, std::memory_order_relaxed);
+    }
+
+    /** @brief Counters written by the producer. */
+    struct alignas(detail::cacheLineSize) ProducerSide {
+        std::atomic<uint64_t> pushes{0};
+        std::atomic<uint64_t> rejected{0};
+        std::atomic<uint64_t> dropped{0};
+        std::atomic<uint64_t> highWater{0};
+        std::array<std::atomic<uint64_t>, Buckets> histogram{};
+    };
+
+    /** @brief Counters written by the consumer. */
+    struct alignas(detail::cacheLineSize) ConsumerSide {
+        std::atomic<uint64_t> pops{0};
+        std::atomic<uint64_t> failedPops{0};
+    };
+
+    ProducerSide producer_;  /**< Producer-owned cache line(s). */
+    ConsumerSide consumer_;  /**< Consumer-owned cache line. */
+};
+
+/**
+ * @brief Whether a Stats policy can instrument a ring of @p capacity slots.
+ *
+ * Slot-timing policies index a fixed array by slot, so their size must match
+ * the ring exactly; counter-only policies fit any ring.
+ */
+template<typename Stats>
+constexpr bool statsFitCapacity(size_t capacity) {
+    return !Stats::timesSlots || Stats::stampedSlots == capacity;
+}
+
+/**
+ * @brief steady_clock time in nanoseconds; portable default for ResidencyStats.
+ */
+struct SteadyClockTicks {
+    static uint64_t now() {
+        return uint64_t(std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count());
+    }
+};
+
+#if defined(__x86_64__) || defined(__i386__)
+/**
+ * @brief Raw time-stamp counter (x86 only); cheaper than a clock call.
+ *
+ * Ticks are in TSC cycles, not nanoseconds. Only comparable across cores on
+ * CPUs with an invariant, synchronized TSC.
+ */
+struct TscTicks {
+    static uint64_t now() { return __builtin_ia32_rdtsc(); }
+};
+#endif
+
+/**
+ * @brief Stats policy that measures how long elements stay in the ring.
+ *
+ * The producer stamps each slot with Clock::now() when it is filled; the
+ * consumer records now minus the stamp into a LatencyHistogram when the slot
+ * is drained. Stamps live in their own array, parallel to the slots, so T's
+ * cache lines are untouched and T needs no extra field. The histogram is
+ * written only by the consumer.
+ *
+ * Combine with the counters by nesting: ResidencyStats<N, RingStats<>>.
+ * With SpscRingBuffer's overwrite policy, a slot the producer refills while
+ * the consumer is popping it may be recorded with the newer stamp.
+ *
+ * @tparam Capacity Slots to stamp; must equal the ring's capacity(). Rings
+ *                  check this at compile time, so RingBufferView, whose
+ *                  capacity is only known at run time, cannot use it.
+ * @tparam Inner    Counter policy to extend (NoRingStats or RingStats<>).
+ * @tparam Clock    Time source with a static uint64_t now().
+ */
+template<size_t Capacity, typename Inner = NoRingStats, typename Clock = SteadyClockTicks>
+class ResidencyStats : public Inner {
+public:
+    static constexpr bool timesSlots = true;         /**< Whether the slot hooks record anything. */
+    static constexpr size_t stampedSlots = Capacity;  /**< Slots the slot hooks index. */
+
+    using Histogram = LatencyHistogram<>;  /**< Histogram of residency times in Clock ticks. */
+
+    /** @brief Producer hook: slot @p slot was just filled. */
+    void stampSlot(size_t slot) {
+        stamps_[slot].store(Clock::now(), std::memory_order_relaxed);
+    }
+
+    /** @brief Consumer hook: slot @p slot is being drained. */
+    void recordResidency(size_t slot) {
+        const uint64_t now = Clock::now();
+        const uint64_t then = stamps_[slot].load(std::memory_order_relaxed);
+        residency_.record(now > then ? now - then : 0);
+    }
+
+    /** @brief Residency times recorded so far, e.g. residency().percentile(99). */
+    const Histogram &residency() const { return residency_; }
+
+    /** @brief Mutable access to the histogram, e.g. to reset() it. */
+    Histogram &residency() { return residency_; }
+
+private:
+    /** Push times, one per slot; written by the producer only. */
+    alignas(detail::cacheLineSize) std::atomic<uint64_t> stamps_[Capacity] {};
+    /** Residency histogram; written by the consumer only. */
+    alignas(detail::cacheLineSize) Histogram residency_;
+};
+} // namespace antBuffers
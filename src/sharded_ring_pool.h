@@ -0,0 +1,189 @@
+#pragma once
+
+#include <cstddef>
+#include <utility>
+
+#include "mpmc_ring_buffer.h"
+#include "ring_detail.h"
+
+namespace antBuffers {
+/**
+ * @file sharded_ring_pool.h
+ * @brief Work queue split into one ring per worker, with work stealing.
+ *
+ * A single ring shared by every worker serializes them all on its two
+ * counters. Here each worker mostly touches only its own shard, so throughput
+ * grows with the number of cores; idle workers steal batches from busy ones
+ * to keep the load balanced.
+ */
+
+/**
+ * @brief Pin the calling thread to one CPU (Linux only); see detail::pinCurrentThread().
+ *
+ * Intended for workers of a ShardedRingPool: pinning worker i to CPU i keeps
+ * each shard in one core's cache and makes neighbouring shards neighbouring
+ * cores, which is the order stealing visits them in.
+ */
+using detail::pinCurrentThread;
+
+/**
+ * @brief Fixed set of per-worker rings with batch work stealing.
+ *
+ * Shard i belongs to worker i. Any thread may push into any shard, but the
+ * fast path is a worker pushing into and popping from its own shard, which
+ * only its own core touches. When its shard runs dry, pop() and pop_bulk()
+ * steal up to half of the next non-empty shard, visiting shards in order of
+ * distance from the thief so that, with workers pinned in order, nearby
+ * cores are tried first. pop() returns one stolen element and moves the
+ * rest into the thief's own shard, so its next pops stay local.
+ *
+ * Each shard is an MpmcRingBuffer, so owners and thieves never need a lock.
+ * Ordering is FIFO within a shard only.
+ *
+ * @tparam T         Element type. Must be MoveAssignable.
+ * @tparam N         Capacity of each shard. Must be a power of two.
+ * @tparam MaxShards Number of shards reserved; shards() of them are used.
+ */
+template<typename T, size_t N, size_t MaxShards = 64>
+class ShardedRingPool {
+    static_assert(MaxShards > 0, "ShardedRingPool needs at least one shard");
+
+public:
+    using value_type = T;  /**< Element type stored in the pool. */
+
+    /** @brief Most elements pop() steals at once; bounds its stack batch. */
+    static constexpr size_t stealBatch = (N / 2 < 64) ? (N + 1) / 2 : 64;
+
+    /**
+     * @brief Construct a pool using @p shards shards (clamped to [1, MaxShards]).
+     */
+    explicit ShardedRingPool(size_t shards = MaxShards)
+        : shardCount_(shards == 0 ? 1 : (shards > MaxShards ? MaxShards : shards)) {}
+
+    ShardedRingPool(const ShardedRingPool &) = delete;
+    ShardedRingPool &operator=(const ShardedRingPool &) = delete;
+
+    /** @brief Number of shards in use. */
+    size_t shards() const { return shardCount_; }
+
+    /** @brief Per-shard capacity. */
+    constexpr size_t shardCapacity() const { return N; }
+
+    /**
+     * @brief Shard that belongs to the CPU the caller is running on.
+     *
+     * Lets unpinned producers push to a shard that is likely already in their
+     * cache. Falls back to shard 0 where the CPU cannot be queried.
+     */
+    size_t localShard() const {
+#if defined(__linux__)
+        const int cpu = ::sched_getcpu();
+        if (cpu >= 0) return size_t(cpu) % shardCount_;
+#endif
+        return 0;
+    }
+
+    //-------------------------------------------------------------------------
+    // Producers
+    //-------------------------------------------------------------------------
+    /**
+     * @brief Push a copy of a value into shard @p shard.
+     *
+     * @return true if pushed; false if that shard is full.
+     */
+    bool push(size_t shard, const T &v) { return ring(shard).push(v); }
+
+    /**
+     * @brief Push a movable value into shard @p shard.
+     *
+     * @return true if pushed; false if that shard is full.
+     */
+    bool push(size_t shard, T &&v) { return ring(shard).push(std::move(v)); }
+
+    //-------------------------------------------------------------------------
+    // Consumers
+    //-------------------------------------------------------------------------
+    /**
+     * @brief Pop one element for worker @p shard, stealing if its shard is empty.
+     *
+     * A steal takes a batch of up to stealBatch elements: the first is
+     * returned and the rest are pushed into @p shard. Should producers have
+     * filled that shard in the meantime, the leftovers go to the next shard
+     * with room, so nothing is lost.
+     *
+     * @return true if an element was popped; false if every shard was empty.
+     */
+    bool pop(size_t shard, T &out) {
+        if (ring(shard).pop(out)) return true;
+        T batch[stealBatch];
+        const size_t n = steal(shard, batch, stealBatch);
+        if (n == 0) return false;
+        out = std::move(batch[0]);
+        for (size_t i = 1; i < n; ++i) {
+            for (size_t d = 0; !ring(shard + d).push(std::move(batch[i])); ++d) detail::cpuRelax();
+        }
+        return true;
+    }
+
+    /**
+     * @brief Pop up to @p max elements for worker @p shard.
+     *
+     * Drains the worker's own shard first; only if that yields nothing does it
+     * steal a batch from one other shard.
+     *
+     * @return Number of elements written to @p out.
+     */
+    size_t pop_bulk(size_t shard, T *out, size_t max) {
+        size_t n = ring(shard).pop_bulk(out, max);
+        if (n == 0 && max != 0) n = steal(shard, out, max);
+        return n;
+    }
+
+    /**
+     * @brief Take a batch from the nearest non-empty shard other than @p thief.
+     *
+     * Takes at most half of the victim's elements (at least one), so the
+     * victim keeps work for itself and two thieves do not ping-pong a shard.
+     * The batch is claimed with one CAS via MpmcRingBuffer::pop_bulk(), so it
+     * costs the victim's owner a single contended operation.
+     *
+     * @return Number of elements written to @p out (0 if nothing to steal).
+     */
+    size_t steal(size_t thief, T *out, size_t max) {
+        for (size_t d = 1; d < shardCount_ && max != 0; ++d) {
+            auto &victim = ring((thief + d) % shardCount_);
+            const size_t avail = victim.size();
+            if (avail == 0) continue;
+            const size_t half = (avail + 1) / 2;
+            const size_t want = half < max ? half : max;
+            const size_t n = victim.pop_bulk(out, want);
+            if (n != 0) return n;
+        }
+        return 0;
+    }
+
+    //-------------------------------------------------------------------------
+    // State
+    //-------------------------------------------------------------------------
+    /**
+     * @brief Total elements over all shards.
+     *
+     * @return Snapshot; only exact when no other thread is operating on the pool.
+     */
+    size_t size() const {
+        size_t n = 0;
+        for (size_t i = 0; i < shardCount_; ++i) n += shards_[i].size();
+        return n;
+    }
+
+    /** @brief Check whether every shard is empty (snapshot). */
+    bool empty() const { return size() == 0; }
+
+    /** @brief Access shard @p i directly, e.g. for per-shard size(). */
+    MpmcRingBuffer<T, N> &ring(size_t i) { return shards_[i % shardCount_]; }
+
+private:
+    size_t               shardCount_;         /**< Shards in use. */
+    MpmcRingBuffer<T, N> shards_[MaxShards];  /**< One ring per worker. */
+};
+} // namespace antBuffers
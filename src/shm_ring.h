@@ -0,0 +1,484 @@
+#pragma once
+
+#if defined(__unix__) || defined(__APPLE__)
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <fcntl.h>
+#include <limits>
+#include <new>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <type_traits>
+#include <unistd.h>
+
+#include "ring_detail.h"
+
+namespace antBuffers {
+/**
+ * @file shm_ring.h
+ * @brief Single-producer/single-consumer rings in POSIX shared memory.
+ *
+ * Two processes attach to the same named region and exchange data with no
+ * syscalls on the fast path: ShmRing<T> moves fixed-size trivially copyable
+ * elements and ShmRecordRing moves variable-length byte records.
+ *
+ * The region starts with a header holding the format version, capacity and
+ * slot size, followed by the producer and consumer counters on separate
+ * cache lines and then the slots. Everything is addressed by offset from the
+ * start of the region, so each process may map it at a different address.
+ */
+
+namespace detail {
+static_assert(std::atomic<uint64_t>::is_always_lock_free,
+              "shared-memory rings need lock-free 64-bit atomics");
+
+/** @brief Marks an initialized region; written last by the creator. */
+constexpr uint32_t shmRingMagic = 0x414E5452;  // "ANTR"
+
+/** @brief Bumped whenever the region layout changes. */
+constexpr uint32_t shmRingVersion = 1;
+
+/** @brief Layout at offset 0 of a shared ring region. */
+struct ShmRingHeader {
+    std::atomic<uint32_t> magic;   /**< shmRingMagic once initialized. */
+    uint32_t version;              /**< shmRingVersion of the creator. */
+    uint64_t capacity;             /**< Slots (ShmRing) or bytes (ShmRecordRing); a power of two. */
+    uint64_t slotSize;             /**< sizeof(T), or 0 for a record ring. */
+
+    alignas(cacheLineSize) std::atomic<uint64_t> head;  /**< Producer counter. */
+    alignas(cacheLineSize) std::atomic<uint64_t> tail;  /**< Consumer counter. */
+};
+
+/** @brief Offset of the first slot from the start of the region. */
+constexpr size_t shmRingDataOffset =
+    (sizeof(ShmRingHeader) + cacheLineSize - 1) / cacheLineSize * cacheLineSize;
+
+/**
+ * @brief Size of a region holding @p capacity slots of @p slotSize bytes
+ *        (bytes for a record ring, where @p slotSize is 0).
+ *
+ * @return false if the size does not fit in size_t or off_t.
+ */
+inline bool shmRingBytes(uint64_t capacity, uint64_t slotSize, size_t &bytes) {
+    const uint64_t slot = slotSize ? slotSize : 1;
+    uint64_t limit = std::numeric_limits<size_t>::max();
+    if (uint64_t(std::numeric_limits<off_t>::max()) < limit) limit = uint64_t(std::numeric_limits<off_t>::max());
+    limit -= shmRingDataOffset;
+    if (capacity > limit / slot) return false;
+    bytes = shmRingDataOffset + size_t(capacity * slot);
+    return true;
+}
+
+/**
+ * @brief RAII mapping of a named shared-memory ring region.
+ *
+ * Owns the mapping only; the name stays until unlink() is called.
+ */
+class ShmRingRegion {
+public:
+    ShmRingRegion() = default;
+    ~ShmRingRegion() { unmap(); }
+
+    ShmRingRegion(const ShmRingRegion &) = delete;
+    ShmRingRegion &operator=(const ShmRingRegion &) = delete;
+
+    ShmRingRegion(ShmRingRegion &&other) noexcept { take(other); }
+
+    ShmRingRegion &operator=(ShmRingRegion &&other) noexcept {
+        if (this != &other) {
+            unmap();
+            take(other);
+        }
+        return *this;
+    }
+
+    /**
+     * @brief Create a new region and initialize its header.
+     *
+     * Fails if @p name already exists.
+     *
+     * @return true on success; false on any system error.
+     */
+    bool create(const char *name, uint64_t capacity, uint64_t slotSize) {
+        size_t bytes;
+        if (!shmRingBytes(capacity, slotSize, bytes)) return false;
+        const int fd = ::shm_open(name, O_CREAT | O_EXCL | O_RDWR, 0600);
+        if (fd < 0) return false;
+        const bool ok = ::ftruncate(fd, off_t(bytes)) == 0 && map(fd, bytes);
+        ::close(fd);
+        if (!ok) {
+            ::shm_unlink(name);
+            return false;
+        }
+
+        ShmRingHeader *h = ::new (base_) ShmRingHeader;
+        h->version = shmRingVersion;
+        h->capacity = capacity;
+        h->slotSize = slotSize;
+        h->head.store(0, std::memory_order_relaxed);
+        h->tail.store(0, std::memory_order_relaxed);
+        h->magic.store(shmRingMagic, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * @brief Attach to a region created by another process.
+     *
+     * @return true if the region exists, is initialized and matches
+     *         @p slotSize and this library's layout version.
+     */
+    bool attach(const char *name, uint64_t slotSize) {
+        const int fd = ::shm_open(name, O_RDWR, 0);
+        if (fd < 0) return false;
+        struct stat st;
+        const bool ok = ::fstat(fd, &st) == 0 && size_t(st.st_size) >= shmRingDataOffset &&
+                        map(fd, size_t(st.st_size));
+        ::close(fd);
+        if (!ok) return false;
+
+        // The acquire on magic makes the creator's header writes visible, so
+        // nothing else in the header may be read before it.
+        const ShmRingHeader *h = header();
+        if (h->magic.load(std::memory_order_acquire) != shmRingMagic) {
+            unmap();
+            return false;
+        }
+        const uint64_t capacity = h->capacity;
+        size_t bytes;
+        if (h->version != shmRingVersion || h->slotSize != slotSize ||
+            capacity > std::numeric_limits<size_t>::max() || !isPowerOfTwo(size_t(capacity)) ||
+            !shmRingBytes(capacity, slotSize, bytes) || bytes > bytes_) {
+            unmap();
+            return false;
+        }
+        return true;
+    }
+
+    /** @brief Remove @p name; existing mappings stay valid. */
+    static void unlink(const char *name) { ::shm_unlink(name); }
+
+    bool valid() const { return base_ != nullptr; }
+
+    ShmRingHeader *header() const { return static_cast<ShmRingHeader *>(base_); }
+
+    uint8_t *data() const { return static_cast<uint8_t *>(base_) + shmRingDataOffset; }
+
+private:
+    bool map(int fd, size_t bytes) {
+        void *p = ::mmap(nullptr, bytes, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+        if (p == MAP_FAILED) return false;
+        base_ = p;
+        bytes_ = bytes;
+        return true;
+    }
+
+    void unmap() {
+        if (base_) ::munmap(base_, bytes_);
+        base_ = nullptr;
+        bytes_ = 0;
+    }
+
+    void take(ShmRingRegion &other) {
+        base_ = other.base_;
+        bytes_ = other.bytes_;
+        other.base_ = nullptr;
+        other.bytes_ = 0;
+    }
+
+    void  *base_  = nullptr;  /**< Start of the mapping. */
+    size_t bytes_ = 0;        /**< Length of the mapping. */
+};
+} // namespace detail
+
+/**
+ * @brief Fixed-size element ring in shared memory, one producer and one
+ *        consumer process.
+ *
+ * Same push/pop contract as SpscRingBuffer. Each side keeps a process-local
+ * copy of the other side's counter and only reads the shared one when the
+ * ring looks full or empty.
+ *
+ * @tparam T Element type. Must be trivially copyable, since it is copied
+ *           between address spaces byte for byte.
+ */
+template<typename T>
+class ShmRing {
+    static_assert(std::is_trivially_copyable<T>::value, "ShmRing requires a trivially copyable T");
+
+public:
+    using value_type = T;  /**< Element type stored in the ring. */
+
+    /**
+     * @brief Create the region @p name holding at least @p minCapacity elements.
+     *
+     * The capacity is rounded up to a power of two. Check valid() afterwards.
+     */
+    static ShmRing create(const char *name, size_t minCapacity) {
+        ShmRing r;
+        r.region_.create(name, detail::nextPowerOfTwo(minCapacity), sizeof(T));
+        r.init();
+        return r;
+    }
+
+    /**
+     * @brief Attach to the region @p name created by another process.
+     *
+     * Fails (valid() == false) if it does not exist or holds a different T size.
+     */
+    static ShmRing attach(const char *name) {
+        ShmRing r;
+        r.region_.attach(name, sizeof(T));
+        r.init();
+        return r;
+    }
+
+    /** @brief Remove the name @p name; attached processes keep working. */
+    static void unlink(const char *name) { detail::ShmRingRegion::unlink(name); }
+
+    /** @brief Whether the region was created or attached successfully. */
+    bool valid() const { return region_.valid(); }
+
+    /**
+     * @brief Push a copy of a value into the ring (producer only).
+     *
+     * @return true if the value was pushed; false if the ring is full or not valid().
+     */
+    bool push(const T &v) {
+        if (!valid()) return false;
+        detail::ShmRingHeader *h = region_.header();
+        const uint64_t head = h->head.load(std::memory_order_relaxed);
+        if (head - cachedTail_ >= capacity_) {
+            cachedTail_ = h->tail.load(std::memory_order_acquire);
+            if (head - cachedTail_ >= capacity_) return false;
+        }
+        std::memcpy(slots_ + (head & mask_) * sizeof(T), &v, sizeof(T));
+        h->head.store(head + 1, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * @brief Pop the oldest element from the ring (consumer only).
+     *
+     * @return true if an element was popped; false if the ring is empty or not valid().
+     */
+    bool pop(T &out) {
+        if (!valid()) return false;
+        detail::ShmRingHeader *h = region_.header();
+        const uint64_t tail = h->tail.load(std::memory_order_relaxed);
+        if (tail == cachedHead_) {
+            cachedHead_ = h->head.load(std::memory_order_acquire);
+            if (tail == cachedHead_) return false;
+        }
+        std::memcpy(&out, slots_ + (tail & mask_) * sizeof(T), sizeof(T));
+        h->tail.store(tail + 1, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * @brief Snapshot of the number of stored elements (0 if not valid()).
+     */
+    size_t size() const {
+        if (!valid()) return 0;
+        const detail::ShmRingHeader *h = region_.header();
+        const uint64_t tail = h->tail.load(std::memory_order_acquire);
+        return size_t(h->head.load(std::memory_order_acquire) - tail);
+    }
+
+    /** @brief Maximum number of elements (0 if not valid()). */
+    size_t capacity() const { return size_t(capacity_); }
+
+    bool empty() const { return size() == 0; }
+
+    bool full() const { return size() == capacity(); }
+
+private:
+    ShmRing() = default;
+
+    /** @brief Cache the layout and seed the local counter copies. */
+    void init() {
+        if (!region_.valid()) return;
+        detail::ShmRingHeader *h = region_.header();
+        capacity_ = h->capacity;
+        mask_ = capacity_ - 1;
+        slots_ = region_.data();
+        cachedHead_ = h->head.load(std::memory_order_acquire);
+        cachedTail_ = h->tail.load(std::memory_order_acquire);
+    }
+
+    detail::ShmRingRegion region_;        /**< Mapping of the shared region. */
+    uint8_t              *slots_ = nullptr;/**< Slot array in this process's mapping. */
+    uint64_t              capacity_ = 0;  /**< Number of slots. */
+    uint64_t              mask_ = 0;      /**< capacity_ - 1. */
+    uint64_t              cachedHead_ = 0;/**< Consumer's last seen head. */
+    uint64_t              cachedTail_ = 0;/**< Producer's last seen tail. */
+};
+
+/**
+ * @brief Variable-length byte record ring in shared memory, one producer and
+ *        one consumer process.
+ *
+ * Each record is stored contiguously as a 32-bit length followed by the
+ * payload, padded to 8 bytes. A record that would cross the end of the data
+ * area is preceded by a skip marker and placed at the start instead, so the
+ * consumer can always read a payload in place with peek()/consume().
+ */
+class ShmRecordRing {
+public:
+    /** @brief Largest payload for a given ring: half the data area, minus the length word. */
+    static constexpr size_t maxRecordFor(size_t capacity) { return capacity / 2 - lengthBytes; }
+
+    /**
+     * @brief Create the region @p name with at least @p minBytes of record space.
+     *
+     * The capacity is rounded up to a power of two (minimum 64 bytes). Check
+     * valid() afterwards.
+     */
+    static ShmRecordRing create(const char *name, size_t minBytes) {
+        ShmRecordRing r;
+        r.region_.create(name, detail::nextPowerOfTwo(minBytes < 64 ? 64 : minBytes), 0);
+        r.init();
+        return r;
+    }
+
+    /** @brief Attach to the record ring @p name created by another process. */
+    static ShmRecordRing attach(const char *name) {
+        ShmRecordRing r;
+        r.region_.attach(name, 0);
+        r.init();
+        return r;
+    }
+
+    /** @brief Remove the name @p name; attached processes keep working. */
+    static void unlink(const char *name) { detail::ShmRingRegion::unlink(name); }
+
+    /** @brief Whether the region was created or attached successfully. */
+    bool valid() const { return region_.valid(); }
+
+    /** @brief Record space in bytes (0 if not valid()). */
+    size_t capacity() const { return size_t(capacity_); }
+
+    /**
+     * @brief Append one record (producer only).
+     *
+     * @return true if the record was published; false if it does not fit now
+     *         or exceeds maxRecordFor(capacity()).
+     */
+    bool push(const uint8_t *data, size_t len) {
+        if (!valid() || len > maxRecordFor(size_t(capacity_))) return false;
+        detail::ShmRingHeader *h = region_.header();
+        const uint64_t head = h->head.load(std::memory_order_relaxed);
+        const uint64_t pos = head & mask_;
+        const uint64_t need = recordBytes(len);
+        const uint64_t toEnd = capacity_ - pos;
+        const uint64_t skip = (need > toEnd) ? toEnd : 0;
+
+        if (head + skip + need - cachedTail_ > capacity_) {
+            cachedTail_ = h->tail.load(std::memory_order_acquire);
+            if (head + skip + need - cachedTail_ > capacity_) return false;
+        }
+
+        if (skip) writeLength(pos, skipMarker);
+        const uint64_t at = skip ? 0 : pos;
+        writeLength(at, uint32_t(len));
+        std::memcpy(base() + at + lengthBytes, data, len);
+        h->head.store(head + skip + need, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * @brief Look at the oldest record in place (consumer only).
+     *
+     * @param[out] data Start of the payload inside the ring.
+     * @param[out] len  Payload length in bytes.
+     * @return true if a record is available; false if the ring is empty.
+     */
+    bool peek(const uint8_t *&data, size_t &len) {
+        if (!valid()) return false;
+        detail::ShmRingHeader *h = region_.header();
+        uint64_t tail = h->tail.load(std::memory_order_relaxed);
+        if (tail == cachedHead_) {
+            cachedHead_ = h->head.load(std::memory_order_acquire);
+            if (tail == cachedHead_) return false;
+        }
+        uint64_t pos = tail & mask_;
+        uint32_t n = readLength(pos);
+        if (n == skipMarker) {
+            // The producer published marker and record together, so the
+            // record at offset 0 is already visible.
+            tail += capacity_ - pos;
+            h->tail.store(tail, std::memory_order_release);
+            pos = 0;
+            n = readLength(0);
+        }
+        data = base() + pos + lengthBytes;
+        len = n;
+        return true;
+    }
+
+    /**
+     * @brief Release the record returned by the last successful peek().
+     */
+    void consume() {
+        detail::ShmRingHeader *h = region_.header();
+        const uint64_t tail = h->tail.load(std::memory_order_relaxed);
+        h->tail.store(tail + recordBytes(readLength(tail & mask_)), std::memory_order_release);
+    }
+
+    /**
+     * @brief Copy out and release the oldest record (consumer only).
+     *
+     * @param dst      Destination for the payload.
+     * @param maxLen   Size of @p dst in bytes.
+     * @param[out] len Payload length in bytes.
+     * @return true if a record was popped; false if the ring is empty or the
+     *         record is larger than @p maxLen (it is then left in the ring).
+     */
+    bool pop(uint8_t *dst, size_t maxLen, size_t &len) {
+        const uint8_t *p;
+        if (!peek(p, len) || len > maxLen) return false;
+        std::memcpy(dst, p, len);
+        consume();
+        return true;
+    }
+
+private:
+    static constexpr size_t   lengthBytes = sizeof(uint32_t);
+    static constexpr uint32_t skipMarker  = 0xFFFFFFFFu;
+
+    ShmRecordRing() = default;
+
+    /** @brief Bytes taken by a record with an @p len byte payload. */
+    static uint64_t recordBytes(size_t len) { return (lengthBytes + len + 7) & ~uint64_t(7); }
+
+    uint8_t *base() const { return region_.data(); }
+
+    uint32_t readLength(uint64_t pos) const {
+        uint32_t n;
+        std::memcpy(&n, base() + pos, sizeof(n));
+        return n;
+    }
+
+    void writeLength(uint64_t pos, uint32_t n) { std::memcpy(base() + pos, &n, sizeof(n)); }
+
+    /** @brief Cache the layout and seed the local counter copies. */
+    void init() {
+        if (!region_.valid()) return;
+        detail::ShmRingHeader *h = region_.header();
+        capacity_ = h->capacity;
+        mask_ = capacity_ - 1;
+        cachedHead_ = h->head.load(std::memory_order_acquire);
+        cachedTail_ = h->tail.load(std::memory_order_acquire);
+    }
+
+    detail::ShmRingRegion region_;        /**< Mapping of the shared region. */
+    uint64_t              capacity_ = 0;  /**< Record space in bytes. */
+    uint64_t              mask_ = 0;      /**< capacity_ - 1. */
+    uint64_t              cachedHead_ = 0;/**< Consumer's last seen head. */
+    uint64_t              cachedTail_ = 0;/**< Producer's last seen tail. */
+};
+} // namespace antBuffers
+
+#endif // POSIX
@@ -0,0 +1,330 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+#include <utility>
+
+#include "ring_detail.h"
+#include "ring_stats.h"
+
+namespace antBuffers {
+/**
+ * @file spsc_ring_buffer.h
+ * @brief Lock-free single-producer/single-consumer ring buffer.
+ *
+ * Same push/pop contract as RingBuffer, but safe to share between exactly one
+ * producer thread (or ISR) and one consumer thread without a mutex.
+ */
+
+/**
+ * @brief What a ring does when pushing into a full buffer.
+ */
+enum class OverflowPolicy {
+    Reject,    /**< push() returns false; only the consumer moves the tail. */
+    Overwrite  /**< push_overwrite() drops the oldest element instead. */
+};
+
+/**
+ * @brief Fixed-capacity, lock-free SPSC circular buffer.
+ *
+ * The producer owns the head counter and the consumer owns the tail counter;
+ * there is no shared element count. Each side lives on its own cache line and
+ * keeps a local copy of the other side's counter, so the opposite line is only
+ * read when the cached value says the ring looks full (producer) or empty
+ * (consumer).
+ *
+ * push() may only be called from the producer thread and pop() only from the
+ * consumer thread. size(), empty() and full() may be called from either side
+ * and return a snapshot that can be stale by the time it is used.
+ *
+ * With OverflowPolicy::Overwrite the producer may also advance the tail to
+ * drop the oldest element, so the tail becomes a CAS target for both sides.
+ * pop() then copies the slot first and only keeps the copy if its CAS on the
+ * tail succeeds; a failed CAS means the producer dropped (and may be
+ * rewriting) that slot, and the copy is discarded. Slots are then held as
+ * relaxed atomic words, so the copy racing the rewrite is well defined; the
+ * producer's acquiring CAS precedes its rewrite and the consumer's releasing
+ * CAS follows its copy, so a copy that saw any rewritten word always loses
+ * the CAS. This requires a trivially copyable T. The counters are then
+ * 64-bit and never wrap, so a
+ * consumer preempted between its copy and its CAS cannot match a tail the
+ * producer has since lapped, whatever N is.
+ *
+ * @tparam T      Element type stored in the buffer. Must be MoveAssignable for move overload.
+ * @tparam N      Compile-time capacity of the buffer (maximum number of elements).
+ * @tparam Policy Behavior when pushing into a full buffer.
+ * @tparam Stats  Instrumentation policy (see ring_stats.h). The producer
+ *                reports occupancy from its cached tail, which can only
+ *                overstate it, so no extra cross-core load is added.
+ */
+template<typename T, size_t N, OverflowPolicy Policy = OverflowPolicy::Reject,
+         typename Stats = NoRingStats>
+class SpscRingBuffer : private Stats {
+    static_assert(Policy != OverflowPolicy::Overwrite || std::is_trivially_copyable<T>::value,
+                  "OverflowPolicy::Overwrite requires a trivially copyable T");
+    static_assert(Policy != OverflowPolicy::Overwrite || N > 1,
+                  "OverflowPolicy::Overwrite requires a capacity of at least 2");
+    static_assert(statsFitCapacity<Stats>(N), "ResidencyStats<Capacity> must match the ring's N");
+
+    // The overwrite tail is CAS'd by both sides, so its counters must never
+    // revisit a value while a stale copy may still be compared against it.
+    static constexpr bool overwrites = Policy == OverflowPolicy::Overwrite;
+    using Counter = std::conditional_t<overwrites, detail::FreeRunningCounter<N>, detail::RingCounter<N>>;
+    using Index   = std::conditional_t<overwrites, uint64_t, size_t>;
+    using Slot    = std::conditional_t<overwrites, detail::AtomicWords<T>, T>;
+
+public:
+    using value_type = T;  /**< Element type stored in the buffer. */
+
+    /**
+     * @brief Default constructor.
+     *
+     * Initializes an empty buffer.
+     */
+    SpscRingBuffer() = default;
+
+    /**
+     * @brief Default destructor.
+     */
+    ~SpscRingBuffer() = default;
+
+    SpscRingBuffer(const SpscRingBuffer &) = delete;
+    SpscRingBuffer &operator=(const SpscRingBuffer &) = delete;
+
+    /**
+     * @brief Push a copy of a value into the buffer (producer only).
+     *
+     * @param v Reference to the value to copy into the buffer.
+     * @return true if the value was successfully pushed; false if buffer is full.
+     */
+    bool push(const T &v) {
+        const Index head = producer_.head.load(std::memory_order_relaxed);
+        if (!hasSpace(head)) {
+            Stats::recordRejected(1);
+            return false;
+        }
+        writeSlot(Counter::slot(head), v);
+        Stats::stampSlot(Counter::slot(head));
+        producer_.head.store(Counter::advance(head), std::memory_order_release);
+        notePush(head);
+        return true;
+    }
+
+    /**
+     * @brief Push a movable value into the buffer (producer only).
+     *
+     * @param v Rvalue reference to the value to move into the buffer.
+     * @return true if the value was successfully pushed; false if buffer is full.
+     */
+    bool push(T &&v) {
+        const Index head = producer_.head.load(std::memory_order_relaxed);
+        if (!hasSpace(head)) {
+            Stats::recordRejected(1);
+            return false;
+        }
+        writeSlot(Counter::slot(head), std::move(v));
+        Stats::stampSlot(Counter::slot(head));
+        producer_.head.store(Counter::advance(head), std::memory_order_release);
+        notePush(head);
+        return true;
+    }
+
+    /**
+     * @brief Push a value, dropping the oldest element if full (producer only).
+     *
+     * Only available with OverflowPolicy::Overwrite. Never fails; drops are
+     * reported to the Stats policy, e.g. RingStats::snapshot().dropped.
+     *
+     * @param v Reference to the value to copy into the buffer.
+     * @return true if the oldest element was dropped to make room; false otherwise.
+     */
+    bool push_overwrite(const T &v) {
+        static_assert(Policy == OverflowPolicy::Overwrite,
+                      "push_overwrite() requires OverflowPolicy::Overwrite");
+        const Index head = producer_.head.load(std::memory_order_relaxed);
+        bool drop = false;
+        if (!hasSpace(head)) {
+            // Full, so the oldest element sits in the slot we are about to
+            // write. Claim it unless the consumer pops it first; either way
+            // the tail has moved on and the slot is free afterwards.
+            Index tail = producer_.cachedTail;
+            drop = consumer_.tail.compare_exchange_strong(tail, Counter::advance(tail),
+                                                          std::memory_order_acq_rel,
+                                                          std::memory_order_acquire);
+            producer_.cachedTail = drop ? Counter::advance(tail) : tail;
+            if (drop) Stats::recordDrop(1);
+        }
+        writeSlot(Counter::slot(head), v);
+        Stats::stampSlot(Counter::slot(head));
+        producer_.head.store(Counter::advance(head), std::memory_order_release);
+        notePush(head);
+        return drop;
+    }
+
+    /**
+     * @brief Pop the oldest element from the buffer (consumer only).
+     *
+     * @param out Reference where the popped value will be stored.
+     * @return true if an element was successfully popped; false if buffer is empty.
+     */
+    bool pop(T &out) {
+        if constexpr (Policy == OverflowPolicy::Overwrite) {
+            Index tail = consumer_.tail.load(std::memory_order_acquire);
+            for (;;) {
+                if (!hasData(tail)) {
+                    Stats::recordFailedPop();
+                    return false;
+                }
+                alignas(T) unsigned char copy[sizeof(T)];
+                buf_[Counter::slot(tail)].load(copy);
+                if (consumer_.tail.compare_exchange_weak(tail, Counter::advance(tail),
+                                                         std::memory_order_acq_rel,
+                                                         std::memory_order_acquire)) {
+                    std::memcpy(&out, copy, sizeof(T));
+                    Stats::recordResidency(Counter::slot(tail));
+                    Stats::recordPop(1);
+                    return true;
+                }
+                // The producer dropped this element; tail now holds the new value.
+            }
+        } else {
+            const Index tail = consumer_.tail.load(std::memory_order_relaxed);
+            if (!hasData(tail)) {
+                Stats::recordFailedPop();
+                return false;
+            }
+            out = std::move(buf_[Counter::slot(tail)]);
+            Stats::recordResidency(Counter::slot(tail));
+            consumer_.tail.store(Counter::advance(tail), std::memory_order_release);
+            Stats::recordPop(1);
+            return true;
+        }
+    }
+
+    /**
+     * @brief Get the current number of stored elements.
+     *
+     * @return Snapshot of the number of elements currently in the buffer.
+     */
+    size_t size() const {
+        // Tail first: the head can only move away from it, never behind it.
+        const Index tail = consumer_.tail.load(std::memory_order_acquire);
+        const Index head = producer_.head.load(std::memory_order_acquire);
+        return size_t(Counter::distance(head, tail));
+    }
+
+    /**
+     * @brief Get the maximum capacity of the buffer.
+     *
+     * @return Compile-time maximum number of elements.
+     */
+    constexpr size_t capacity() const {
+        return N;
+    }
+
+    /**
+     * @brief Check if the buffer is empty.
+     *
+     * @return true if there are no elements stored; false otherwise.
+     */
+    bool empty() const {
+        return size() == 0;
+    }
+
+    /**
+     * @brief Check if the buffer is full.
+     *
+     * @return true if buffer has reached its capacity; false otherwise.
+     */
+    bool full() const {
+        return size() == N;
+    }
+
+    /**
+     * @brief Instrumentation counters; snapshot() may be called from any thread.
+     */
+    const Stats &stats() const {
+        return *this;
+    }
+
+    /**
+     * @brief Mutable access to the instrumentation, e.g. to reset() it.
+     */
+    Stats &stats() {
+        return *this;
+    }
+
+private:
+    /** @brief Store @p v into slot @p i, word by word under OverflowPolicy::Overwrite. */
+    template<typename V>
+    void writeSlot(size_t i, V &&v) {
+        if constexpr (overwrites) {
+            buf_[i].store(v);
+        } else {
+            buf_[i] = std::forward<V>(v);
+        }
+    }
+
+    /** @brief Report one push at @p head to Stats, using the producer's cached tail. */
+    void notePush(Index head) {
+        if constexpr (Stats::enabled) {
+            const auto n = Counter::distance(Counter::advance(head), producer_.cachedTail);
+            Stats::recordPush(1, n < N ? size_t(n) : N, N);
+        }
+    }
+
+    /**
+     * @brief Producer-side check for a free slot, refreshing the cached tail
+     *        only when the ring looks full.
+     */
+    bool hasSpace(Index head) {
+        if (Counter::distance(head, producer_.cachedTail) < N) return true;
+        producer_.cachedTail = consumer_.tail.load(std::memory_order_acquire);
+        return Counter::distance(head, producer_.cachedTail) < N;
+    }
+
+    /**
+     * @brief Consumer-side check for a readable slot, refreshing the cached
+     *        head only when the ring looks empty.
+     */
+    bool hasData(Index tail) {
+        if (ahead(consumer_.cachedHead, tail)) return true;
+        consumer_.cachedHead = producer_.head.load(std::memory_order_acquire);
+        return ahead(consumer_.cachedHead, tail);
+    }
+
+    /**
+     * @brief Whether @p head is past @p tail.
+     *
+     * Under OverflowPolicy::Overwrite the producer can move the tail beyond a
+     * stale cached head, so "different" no longer implies "ahead".
+     */
+    static bool ahead(Index head, Index tail) {
+        if constexpr (Policy == OverflowPolicy::Overwrite) {
+            const auto n = Counter::distance(head, tail);
+            return n != 0 && n <= N;
+        } else {
+            return head != tail;
+        }
+    }
+
+    /** @brief State written by the producer. */
+    struct alignas(detail::cacheLineSize) ProducerSide {
+        std::atomic<Index> head{0};  /**< Counter of the next slot to write. */
+        Index cachedTail = 0;        /**< Last tail value seen by the producer. */
+    };
+
+    /** @brief State written by the consumer. */
+    struct alignas(detail::cacheLineSize) ConsumerSide {
+        std::atomic<Index> tail{0};  /**< Counter of the next slot to read. */
+        Index cachedHead = 0;        /**< Last head value seen by the consumer. */
+    };
+
+    ProducerSide producer_;                    /**< Producer-owned cache line. */
+    ConsumerSide consumer_;                    /**< Consumer-owned cache line. */
+    alignas(detail::cacheLineSize) Slot buf_[N];  /**< Internal storage array of size N. */
+};
+} // namespace antBuffers
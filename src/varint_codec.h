@@ -0,0 +1,261 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#if defined(__SSSE3__)
+#include <tmmintrin.h>
+#elif defined(__ARM_NEON) && defined(__aarch64__) && !defined(__ARM_BIG_ENDIAN)
+#include <arm_neon.h>
+#endif
+
+namespace antBuffers {
+/**
+ * @file varint_codec.h
+ * @brief Unchecked LEB128 varint and ZigZag codecs on raw byte pointers.
+ *
+ * A varint stores 7 bits per byte, least-significant group first, with the
+ * top bit of each byte set when more bytes follow: values below 128 take one
+ * byte, below 16384 two, and a full uint64_t at most ten. ZigZag maps signed
+ * values of small magnitude to small unsigned ones (0, -1, 1, -2 -> 0, 1, 2, 3)
+ * so they stay short too. Callers are responsible for bounds checks on writes.
+ */
+namespace detail {
+
+/** @brief Longest LEB128 encoding of a uint64_t. */
+constexpr size_t maxVarUIntBytes = 10;
+
+/** @brief Longest LEB128 encoding of a uint32_t. */
+constexpr size_t maxVarUInt32Bytes = 5;
+
+/** @brief Map a signed value to an unsigned one with small magnitudes first. */
+inline uint64_t zigZagEncode(int64_t v)
+{
+    return (uint64_t(v) << 1) ^ uint64_t(v >> 63);
+}
+
+/** @brief Inverse of zigZagEncode(). */
+inline int64_t zigZagDecode(uint64_t v)
+{
+    return int64_t((v >> 1) ^ (~(v & 1) + 1));
+}
+
+/** @brief Number of bytes encodeVarUInt() writes for @p v (1 to 10). */
+inline size_t varUIntSize(uint64_t v)
+{
+    size_t n = 1;
+    while (v >= 0x80) {
+        v >>= 7;
+        ++n;
+    }
+    return n;
+}
+
+/**
+ * @brief Write @p v as LEB128 at @p p.
+ *
+ * @return Bytes written, always varUIntSize(v).
+ */
+inline size_t encodeVarUInt(uint8_t *p, uint64_t v)
+{
+    size_t n = 0;
+    while (v >= 0x80) {
+        p[n++] = uint8_t(v | 0x80);
+        v >>= 7;
+    }
+    p[n++] = uint8_t(v);
+    return n;
+}
+
+/**
+ * @brief Decode one LEB128 value from at most @p avail bytes at @p p.
+ *
+ * Rejects encodings longer than ten bytes and a tenth byte carrying bits
+ * beyond 64.
+ *
+ * @return Bytes consumed; 0 if the value is truncated or does not fit.
+ */
+inline size_t decodeVarUInt(const uint8_t *p, size_t avail, uint64_t &out)
+{
+    uint64_t v = 0;
+    const size_t limit = avail < maxVarUIntBytes ? avail : maxVarUIntBytes;
+    for (size_t i = 0; i < limit; ++i) {
+        const uint8_t b = p[i];
+        if (i == maxVarUIntBytes - 1 && b > 1) return 0;
+        v |= uint64_t(b & 0x7F) << (7 * i);
+        if (!(b & 0x80)) {
+            out = v;
+            return i + 1;
+        }
+    }
+    return 0;
+}
+
+/**
+ * @brief decodeVarUInt() for values that must fit in 32 bits (at most five bytes).
+ */
+inline size_t decodeVarUInt32(const uint8_t *p, size_t avail, uint32_t &out)
+{
+    uint32_t v = 0;
+    const size_t limit = avail < maxVarUInt32Bytes ? avail : maxVarUInt32Bytes;
+    for (size_t i = 0; i < limit; ++i) {
+        const uint8_t b = p[i];
+        if (i == maxVarUInt32Bytes - 1 && b > 0x0F) return 0;
+        v |= uint32_t(b & 0x7F) << (7 * i);
+        if (!(b & 0x80)) {
+            out = v;
+            return i + 1;
+        }
+    }
+    return 0;
+}
+
+//-------------------------------------------------------------------------
+// Bulk decode
+//-------------------------------------------------------------------------
+/**
+ * @brief Shuffle that gathers the leading one- and two-byte varints of an
+ *        8-byte window into 16-bit lanes.
+ */
+struct VarIntShuffle {
+    uint8_t values;       /**< Complete varints of at most two bytes at the window start. */
+    uint8_t consumed;     /**< Bytes those varints occupy. */
+    uint8_t shuffle[16];  /**< Byte shuffle; 0x80 yields zero. */
+};
+
+/** @brief One VarIntShuffle per pattern of continuation bits in 8 bytes. */
+struct VarIntShuffleTable {
+    VarIntShuffle entry[256];
+};
+
+/**
+ * @brief Build the shuffle table at compile time (masked VByte, Plaisance et al.).
+ *
+ * Bit j of the index is the continuation bit of byte j. An entry stops at the
+ * first varint that is longer than two bytes or runs past the window, so
+ * values == 0 means the next varint needs the scalar decoder.
+ */
+constexpr VarIntShuffleTable makeVarIntShuffleTable()
+{
+    VarIntShuffleTable t{};
+    for (unsigned mask = 0; mask < 256; ++mask) {
+        VarIntShuffle &e = t.entry[mask];
+        for (auto &s : e.shuffle) s = 0x80;
+        unsigned pos = 0;
+        unsigned k = 0;
+        while (pos < 8) {
+            unsigned end = pos;
+            while (end < 8 && (mask >> end) & 1) ++end;
+            if (end == 8 || end - pos > 1) break;
+            e.shuffle[2 * k] = uint8_t(pos);
+            if (end > pos) e.shuffle[2 * k + 1] = uint8_t(end);
+            ++k;
+            pos = end + 1;
+        }
+        e.values = uint8_t(k);
+        e.consumed = uint8_t(pos);
+    }
+    return t;
+}
+
+/** @brief The shared shuffle table (4.5 KiB), emitted only where a SIMD decoder uses it. */
+inline constexpr VarIntShuffleTable varIntShuffles = makeVarIntShuffleTable();
+
+/**
+ * @brief Decode @p count 32-bit LEB128 values from at most @p avail bytes at @p p.
+ *
+ * With SSSE3 or AArch64 NEON, each step loads 16 bytes and extracts their
+ * continuation bits: a block without any decodes as 16 one-byte values, and
+ * otherwise one table shuffle decodes the run of one- and two-byte values in
+ * the first 8 bytes. Longer values, and the tail where fewer than 16 values
+ * or bytes remain, use the scalar decoder.
+ *
+ * @param[out] dst  Decoded values; contents unspecified on failure.
+ * @param[out] used Bytes consumed on success.
+ * @return true if all values were decoded; false if the input is truncated
+ *         or a value does not fit in 32 bits.
+ */
+inline bool decodeVarUInt32Array(uint32_t *dst, size_t count, const uint8_t *p, size_t avail, size_t &used)
+{
+    size_t i = 0;
+    size_t pos = 0;
+#if defined(__SSSE3__)
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i low7 = _mm_set1_epi16(0x007F);
+    const __m128i high7 = _mm_set1_epi16(0x7F00);
+    while (count - i >= 16 && avail - pos >= 16) {
+        const __m128i in = _mm_loadu_si128(reinterpret_cast<const __m128i *>(p + pos));
+        const unsigned mask = unsigned(_mm_movemask_epi8(in));
+        if (mask == 0) {
+            const __m128i lo = _mm_unpacklo_epi8(in, zero);
+            const __m128i hi = _mm_unpackhi_epi8(in, zero);
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(dst + i), _mm_unpacklo_epi16(lo, zero));
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(dst + i + 4), _mm_unpackhi_epi16(lo, zero));
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(dst + i + 8), _mm_unpacklo_epi16(hi, zero));
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(dst + i + 12), _mm_unpackhi_epi16(hi, zero));
+            i += 16;
+            pos += 16;
+            continue;
+        }
+        const VarIntShuffle &e = varIntShuffles.entry[mask & 0xFF];
+        if (e.values == 0) {
+            const size_t n = decodeVarUInt32(p + pos, avail - pos, dst[i]);
+            if (n == 0) return false;
+            ++i;
+            pos += n;
+            continue;
+        }
+        const __m128i x = _mm_shuffle_epi8(in, _mm_loadu_si128(reinterpret_cast<const __m128i *>(e.shuffle)));
+        const __m128i v = _mm_or_si128(_mm_and_si128(x, low7), _mm_srli_epi16(_mm_and_si128(x, high7), 1));
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(dst + i), _mm_unpacklo_epi16(v, zero));
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(dst + i + 4), _mm_unpackhi_epi16(v, zero));
+        i += e.values;
+        pos += e.consumed;
+    }
+#elif defined(__ARM_NEON) && defined(__aarch64__) && !defined(__ARM_BIG_ENDIAN)
+    const int8_t bitShifts[16] = {0, 1, 2, 3, 4, 5, 6, 7, 0, 1, 2, 3, 4, 5, 6, 7};
+    const int8x16_t shifts = vld1q_s8(bitShifts);
+    const uint16x8_t low7 = vdupq_n_u16(0x007F);
+    const uint16x8_t high7 = vdupq_n_u16(0x7F00);
+    while (count - i >= 16 && avail - pos >= 16) {
+        const uint8x16_t in = vld1q_u8(p + pos);
+        const uint8x16_t bits = vshlq_u8(vshrq_n_u8(in, 7), shifts);
+        const unsigned mask = unsigned(vaddv_u8(vget_low_u8(bits))) | (unsigned(vaddv_u8(vget_high_u8(bits))) << 8);
+        if (mask == 0) {
+            const uint16x8_t lo = vmovl_u8(vget_low_u8(in));
+            const uint16x8_t hi = vmovl_u8(vget_high_u8(in));
+            vst1q_u32(dst + i, vmovl_u16(vget_low_u16(lo)));
+            vst1q_u32(dst + i + 4, vmovl_u16(vget_high_u16(lo)));
+            vst1q_u32(dst + i + 8, vmovl_u16(vget_low_u16(hi)));
+            vst1q_u32(dst + i + 12, vmovl_u16(vget_high_u16(hi)));
+            i += 16;
+            pos += 16;
+            continue;
+        }
+        const VarIntShuffle &e = varIntShuffles.entry[mask & 0xFF];
+        if (e.values == 0) {
+            const size_t n = decodeVarUInt32(p + pos, avail - pos, dst[i]);
+            if (n == 0) return false;
+            ++i;
+            pos += n;
+            continue;
+        }
+        const uint16x8_t x = vreinterpretq_u16_u8(vqtbl1q_u8(in, vld1q_u8(e.shuffle)));
+        const uint16x8_t v = vorrq_u16(vandq_u16(x, low7), vshrq_n_u16(vandq_u16(x, high7), 1));
+        vst1q_u32(dst + i, vmovl_u16(vget_low_u16(v)));
+        vst1q_u32(dst + i + 4, vmovl_u16(vget_high_u16(v)));
+        i += e.values;
+        pos += e.consumed;
+    }
+#endif
+    for (; i < count; ++i) {
+        const size_t n = decodeVarUInt32(p + pos, avail - pos, dst[i]);
+        if (n == 0) return false;
+        pos += n;
+    }
+    used = pos;
+    return true;
+}
+
+} // namespace detail
+} // namespace antBuffers
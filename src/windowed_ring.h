@@ -0,0 +1,182 @@
+#pragma once
+
+#include <cstddef>
+#include <type_traits>
+
+namespace antBuffers {
+/**
+ * @file windowed_ring.h
+ * @brief Sliding window of the last N samples with O(1) aggregate queries.
+ *
+ * Replaces "keep the window in a RingBuffer and rescan it on every sample":
+ * min, max, mean and variance are maintained as samples enter and leave, so
+ * a dashboard refresh costs the same for a window of 16 or 16384 samples.
+ */
+
+/**
+ * @brief Fixed-capacity sample window with incrementally maintained statistics.
+ *
+ * - Mean and variance use Welford-style updates for insertion, removal and
+ *   in-place replacement of the oldest sample, in double precision.
+ * - Min and max use monotonic deques of slot indices: each sample is pushed
+ *   and popped at most once per deque, so push() is amortized O(1) and every
+ *   query is O(1).
+ *
+ * push() on a full window evicts the oldest sample (count-based window).
+ * For a time-based window, call evictOldest() while oldest() is too old.
+ * No dynamic allocation; not thread-safe, like RingBuffer.
+ *
+ * @tparam T Arithmetic sample type.
+ * @tparam N Window length in samples.
+ */
+template<typename T, size_t N>
+class WindowedRing {
+    static_assert(std::is_arithmetic<T>::value, "WindowedRing requires an arithmetic sample type");
+    static_assert(N > 0, "WindowedRing needs a window of at least one sample");
+
+public:
+    using value_type = T;  /**< Sample type. */
+
+    WindowedRing() = default;
+
+    /**
+     * @brief Add a sample, evicting the oldest one if the window is full.
+     *
+     * @return true if a sample was evicted to make room; false otherwise.
+     */
+    bool push(T v) {
+        const double x = double(v);
+        const bool evict = full();
+        const size_t slot = evict ? tail_ : wrap(tail_ + count_);
+        if (evict) {
+            // Replace the oldest sample in one Welford step.
+            const double old = double(samples_[slot]);
+            const double oldMean = mean_;
+            mean_ += (x - old) / double(N);
+            m2_ += (x - old) * (x - mean_ + old - oldMean);
+            if (m2_ < 0) m2_ = 0;  // Rounding can take a near-zero sum negative.
+            dropFront(minQ_, slot);
+            dropFront(maxQ_, slot);
+            tail_ = wrap(tail_ + 1);
+        } else {
+            ++count_;
+            const double d = x - mean_;
+            mean_ += d / double(count_);
+            m2_ += d * (x - mean_);
+        }
+        samples_[slot] = v;
+        // Later samples outlive earlier ones, so anything not smaller (resp.
+        // larger) than the newcomer can never be the minimum (resp. maximum).
+        pushBack(minQ_, slot, [&](size_t s) { return samples_[s] >= v; });
+        pushBack(maxQ_, slot, [&](size_t s) { return samples_[s] <= v; });
+        return evict;
+    }
+
+    /**
+     * @brief Remove the oldest sample, e.g. once it falls out of a time window.
+     *
+     * @return true if a sample was removed; false if the window is empty.
+     */
+    bool evictOldest() {
+        if (empty()) return false;
+        const size_t slot = tail_;
+        const double x = double(samples_[slot]);
+        if (count_ == 1) {
+            mean_ = m2_ = 0;
+        } else {
+            const double oldMean = mean_;
+            mean_ -= (x - mean_) / double(count_ - 1);
+            m2_ -= (x - oldMean) * (x - mean_);
+            if (m2_ < 0) m2_ = 0;
+        }
+        dropFront(minQ_, slot);
+        dropFront(maxQ_, slot);
+        tail_ = wrap(tail_ + 1);
+        --count_;
+        return true;
+    }
+
+    /**
+     * @brief Drop every sample and reset the aggregates.
+     */
+    void clear() {
+        tail_ = count_ = 0;
+        minQ_ = maxQ_ = Deque{};
+        mean_ = m2_ = 0;
+    }
+
+    //-------------------------------------------------------------------------
+    // State
+    //-------------------------------------------------------------------------
+    /** @brief Number of samples in the window. */
+    size_t size() const { return count_; }
+
+    /** @brief Window length. */
+    constexpr size_t capacity() const { return N; }
+
+    /** @brief Check if the window holds no samples. */
+    bool empty() const { return count_ == 0; }
+
+    /** @brief Check if the window holds N samples. */
+    bool full() const { return count_ == N; }
+
+    /** @brief Oldest sample. Requires !empty(). */
+    T oldest() const { return samples_[tail_]; }
+
+    /** @brief Newest sample. Requires !empty(). */
+    T newest() const { return samples_[wrap(tail_ + count_ - 1)]; }
+
+    //-------------------------------------------------------------------------
+    // Aggregates, all O(1)
+    //-------------------------------------------------------------------------
+    /** @brief Smallest sample in the window. Requires !empty(). */
+    T min() const { return samples_[minQ_.slots[minQ_.head]]; }
+
+    /** @brief Largest sample in the window. Requires !empty(). */
+    T max() const { return samples_[maxQ_.slots[maxQ_.head]]; }
+
+    /** @brief Arithmetic mean of the window (0 if empty). */
+    double mean() const { return mean_; }
+
+    /** @brief Population variance of the window (0 if empty). */
+    double variance() const { return count_ ? m2_ / double(count_) : 0; }
+
+    /** @brief Sample (Bessel-corrected) variance (0 for fewer than two samples). */
+    double sampleVariance() const { return count_ > 1 ? m2_ / double(count_ - 1) : 0; }
+
+private:
+    /** @brief Fixed circular deque of slot indices, monotonic in sample value. */
+    struct Deque {
+        size_t slots[N] = {};  /**< Slot indices, front at head. */
+        size_t head = 0;       /**< Index of the front entry. */
+        size_t size = 0;       /**< Entries in use. */
+    };
+
+    /** @brief Map an index in [0, 2N) back into [0, N). */
+    static size_t wrap(size_t i) { return (i >= N) ? i - N : i; }
+
+    /** @brief Remove the front entry if it refers to the slot being evicted. */
+    static void dropFront(Deque &q, size_t slot) {
+        if (q.size && q.slots[q.head] == slot) {
+            q.head = wrap(q.head + 1);
+            --q.size;
+        }
+    }
+
+    /** @brief Pop dominated entries off the back, then append @p slot. */
+    template<typename Dominated>
+    static void pushBack(Deque &q, size_t slot, Dominated dominated) {
+        while (q.size && dominated(q.slots[wrap(q.head + q.size - 1)])) --q.size;
+        q.slots[wrap(q.head + q.size)] = slot;
+        ++q.size;
+    }
+
+    T      samples_[N] = {};  /**< Sample storage, oldest at tail_. */
+    size_t tail_  = 0;        /**< Slot of the oldest sample. */
+    size_t count_ = 0;        /**< Samples in the window. */
+    Deque  minQ_;             /**< Increasing values: front is the minimum. */
+    Deque  maxQ_;             /**< Decreasing values: front is the maximum. */
+    double mean_ = 0;         /**< Running mean. */
+    double m2_   = 0;         /**< Running sum of squared deviations from the mean. */
+};
+} // namespace antBuffers
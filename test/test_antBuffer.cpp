@@ -85,3 +85,27 @@ TEST_CASE("antBuffers::RingBuffer respects capacity", "[antBuffers][RingBuffer]"
     REQUIRE(rb.pop(out));
     REQUIRE(rb.empty());
 }
+
+//-------------------------------------------------------------------------
+// RingBufferView Factory Tests
+//-------------------------------------------------------------------------
+TEST_CASE("make_ring_view() rounds capacity down to a power of two", "[antBuffers][RingBufferView]") {
+    alignas(uint32_t) unsigned char raw[6 * sizeof(uint32_t)];
+    auto rv = antBuffers::make_ring_view<uint32_t>(raw, 6);
+    REQUIRE(rv.capacity() == 4);
+
+    for (uint32_t i = 0; i < 4; ++i) REQUIRE(rv.push(i));
+    REQUIRE_FALSE(rv.push(4));
+    uint32_t v;
+    REQUIRE(rv.pop(v));
+    REQUIRE(v == 0);
+}
+
+//-------------------------------------------------------------------------
+// ByteRing Factory Tests
+//-------------------------------------------------------------------------
+TEST_CASE_METHOD(RawBufferFixture, "make_byte_ring() constructs correctly", "[antBuffers][ByteRing]") {
+    auto br = antBuffers::make_byte_ring(raw, SIZE);
+    REQUIRE(br.capacity() == SIZE);
+    REQUIRE(br.writeRemaining() == SIZE);
+}
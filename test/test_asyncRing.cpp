@@ -0,0 +1,127 @@
+#define CATCH_CONFIG_MAIN
+#include <catch.hpp>
+#include "async_ring.h"
+#include "ring_buffer.h"
+#include <coroutine>
+#include <string>
+#include <vector>
+
+using antBuffers::AsyncRing;
+using antBuffers::RingBuffer;
+
+namespace {
+/** @brief Minimal eagerly-started, fire-and-forget coroutine for the tests. */
+struct Task {
+    struct promise_type {
+        Task get_return_object() { return {}; }
+        std::suspend_never initial_suspend() noexcept { return {}; }
+        std::suspend_never final_suspend() noexcept { return {}; }
+        void return_void() {}
+        void unhandled_exception() { std::terminate(); }
+    };
+};
+
+Task consume(AsyncRing<RingBuffer<int, 2>> &ring, std::vector<int> &out, int count) {
+    for (int i = 0; i < count; ++i) out.push_back(co_await ring.async_pop());
+}
+
+Task produce(AsyncRing<RingBuffer<int, 2>> &ring, int first, int count, int &done) {
+    for (int i = 0; i < count; ++i) co_await ring.async_push(first + i);
+    ++done;
+}
+} // namespace
+
+// 1) Awaiting on a non-empty ring completes without suspending
+TEST_CASE("async_pop completes immediately when data is ready", "[AsyncRing][Pop]") {
+    AsyncRing<RingBuffer<int, 2>> ring;
+    REQUIRE(ring.push(1));
+    REQUIRE(ring.push(2));
+    std::vector<int> got;
+    consume(ring, got, 2);
+    REQUIRE(got == std::vector<int>{1, 2});
+    REQUIRE(ring.ring().empty());
+}
+
+// 2) A suspended consumer is resumed by a plain push
+TEST_CASE("suspended consumer resumes on push", "[AsyncRing][Pop]") {
+    AsyncRing<RingBuffer<int, 2>> ring;
+    std::vector<int> got;
+    consume(ring, got, 3);
+    REQUIRE(got.empty());
+
+    REQUIRE(ring.push(10));
+    REQUIRE(got == std::vector<int>{10});
+    REQUIRE(ring.push(11));
+    REQUIRE(ring.push(12));
+    REQUIRE(got == std::vector<int>{10, 11, 12});
+    REQUIRE(ring.ring().empty());  // handed over directly, never stored
+}
+
+// 3) A suspended producer is resumed by a plain pop
+TEST_CASE("suspended producer resumes on pop", "[AsyncRing][Push]") {
+    AsyncRing<RingBuffer<int, 2>> ring;
+    int done = 0;
+    produce(ring, 1, 4, done);
+    REQUIRE(done == 0);
+    REQUIRE(ring.ring().full());
+
+    int v;
+    for (int expected = 1; expected <= 4; ++expected) {
+        REQUIRE(ring.pop(v));
+        REQUIRE(v == expected);
+    }
+    REQUIRE(done == 1);
+    REQUIRE_FALSE(ring.pop(v));
+}
+
+// 4) Many producer and consumer coroutines on one thread
+TEST_CASE("many coroutines multiplex on one thread", "[AsyncRing][Multiplex]") {
+    AsyncRing<RingBuffer<int, 2>> ring;
+    std::vector<int> a, b;
+    int done = 0;
+    consume(ring, a, 50);
+    consume(ring, b, 50);
+    produce(ring, 0, 50, done);
+    produce(ring, 1000, 50, done);
+
+    REQUIRE(done == 2);
+    REQUIRE(a.size() == 50);
+    REQUIRE(b.size() == 50);
+    int total = 0;
+    for (int v : a) total += v;
+    for (int v : b) total += v;
+    REQUIRE(total == 2 * (49 * 50 / 2) + 50 * 1000);
+}
+
+// 5) Non-trivial element types
+TEST_CASE("async_push moves strings through the ring", "[AsyncRing][Move]") {
+    AsyncRing<RingBuffer<std::string, 1>> ring;
+    auto task = [&]() -> Task { co_await ring.async_push("hello"); co_await ring.async_push("world"); };
+    task();
+    std::string s;
+    REQUIRE(ring.pop(s)); REQUIRE(s == "hello");
+    REQUIRE(ring.pop(s)); REQUIRE(s == "world");
+}
+
+// 6) Element types without a default constructor
+namespace {
+struct Tagged {
+    explicit Tagged(int id) : id(id) {}
+    int id;
+};
+}
+
+TEST_CASE("async_pop works without a default constructor", "[AsyncRing][Pop]") {
+    AsyncRing<RingBuffer<Tagged, 2>> ring;
+    std::vector<int> got;
+    auto task = [&]() -> Task {
+        for (int i = 0; i < 3; ++i) got.push_back((co_await ring.async_pop()).id);
+    };
+    REQUIRE(ring.push(Tagged(1)));  // ready path
+    task();
+    REQUIRE(got == std::vector<int>{1});
+    REQUIRE(ring.push(Tagged(2)));  // handed to the suspended consumer
+    REQUIRE(ring.push(Tagged(3)));
+    REQUIRE(got == std::vector<int>{1, 2, 3});
+    REQUIRE(ring.ring().empty());
+}
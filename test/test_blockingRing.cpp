@@ -0,0 +1,99 @@
+#define CATCH_CONFIG_MAIN
+#include <catch.hpp>
+#include "blocking_ring.h"
+#include "mpmc_ring_buffer.h"
+#include "spsc_ring_buffer.h"
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <thread>
+#include <vector>
+
+using antBuffers::BlockingRing;
+using antBuffers::MpmcRingBuffer;
+using antBuffers::SpscRingBuffer;
+using namespace std::chrono_literals;
+
+// 1) Non-blocking calls keep the wrapped ring's contract
+TEST_CASE("push/pop without waiting", "[BlockingRing][PushPop]") {
+    BlockingRing<SpscRingBuffer<int, 2>> br;
+    REQUIRE(br.push(1));
+    REQUIRE(br.push(2));
+    REQUIRE_FALSE(br.push(3));
+    REQUIRE(br.ring().full());
+    int v;
+    REQUIRE(br.pop(v)); REQUIRE(v == 1);
+    REQUIRE(br.pop(v)); REQUIRE(v == 2);
+    REQUIRE_FALSE(br.pop(v));
+}
+
+// 2) Timeouts
+TEST_CASE("pop_wait and push_wait time out", "[BlockingRing][Timeout]") {
+    BlockingRing<SpscRingBuffer<int, 1>> br;
+    int v;
+    const auto start = std::chrono::steady_clock::now();
+    REQUIRE_FALSE(br.pop_wait(v, 20ms));
+    REQUIRE(std::chrono::steady_clock::now() - start >= 20ms);
+
+    REQUIRE(br.push_wait(7, 0ms));
+    REQUIRE_FALSE(br.push_wait(8, 5ms));
+    REQUIRE(br.pop_wait(v, 0ms));
+    REQUIRE(v == 7);
+}
+
+// 3) push_wait(T&&) only moves on success
+TEST_CASE("push_wait(T&&) leaves the value intact on timeout", "[BlockingRing][Move]") {
+    BlockingRing<SpscRingBuffer<std::string, 1>> br;
+    REQUIRE(br.push("a"));
+    std::string b = "b";
+    REQUIRE_FALSE(br.push_wait(std::move(b), 1ms));
+    REQUIRE(b == "b");
+}
+
+// 4) A parked consumer is woken by the producer
+TEST_CASE("parked consumer wakes on push", "[BlockingRing][Threads]") {
+    BlockingRing<SpscRingBuffer<int, 4>> br;
+    std::thread producer([&] {
+        std::this_thread::sleep_for(20ms);  // long enough for the consumer to park
+        br.push(42);
+    });
+    int v = 0;
+    REQUIRE(br.pop_wait(v, 5s));
+    REQUIRE(v == 42);
+    producer.join();
+}
+
+// 5) Small ring forces both sides to park repeatedly; every element arrives once
+TEST_CASE("blocking transfer through MPMC ring", "[BlockingRing][Threads]") {
+    constexpr uint32_t PER_PRODUCER = 20000;
+    constexpr unsigned PRODUCERS = 3;
+    constexpr unsigned CONSUMERS = 3;
+    BlockingRing<MpmcRingBuffer<uint32_t, 4>> br;
+    std::atomic<uint64_t> sum{0};
+    std::atomic<uint32_t> received{0};
+
+    std::vector<std::thread> threads;
+    for (unsigned p = 0; p < PRODUCERS; ++p) {
+        threads.emplace_back([&] {
+            for (uint32_t i = 1; i <= PER_PRODUCER; ++i) {
+                while (!br.push_wait(i, 1s)) {}
+            }
+        });
+    }
+    for (unsigned c = 0; c < CONSUMERS; ++c) {
+        threads.emplace_back([&] {
+            uint32_t v;
+            while (received.load() < PRODUCERS * PER_PRODUCER) {
+                if (br.pop_wait(v, 10ms)) {
+                    sum.fetch_add(v);
+                    received.fetch_add(1);
+                }
+            }
+        });
+    }
+    for (auto &t : threads) t.join();
+
+    REQUIRE(received.load() == PRODUCERS * PER_PRODUCER);
+    REQUIRE(sum.load() == uint64_t(PRODUCERS) * PER_PRODUCER * (PER_PRODUCER + 1) / 2);
+}
@@ -1,7 +1,12 @@
 #define CATCH_CONFIG_MAIN
 #include <catch.hpp>
 #include <byte_buffer.h>
+#include <algorithm>
+#include <cmath>
 #include <cstdint>
+#include <limits>
+#include <random>
+#include <vector>
 
 using antBuffers::ByteBuffer;
 
@@ -89,8 +94,8 @@ TEMPLATE_TEST_CASE_SIG(
     "16-bit LE/BE read+write with cursors", "[ByteBuffer][16bit]",
     ((auto writeFn, auto readFn, uint16_t value, uint8_t b0, uint8_t b1),
      writeFn, readFn, value, b0, b1),
-    (ByteBuffer::writeUInt16LE, ByteBuffer::readUInt16LE, 0x1234, 0x34, 0x12),
-    (ByteBuffer::writeUInt16BE, ByteBuffer::readUInt16BE, 0xABCD, 0xAB, 0xCD)
+    (&ByteBuffer::writeUInt16LE, &ByteBuffer::readUInt16LE, 0x1234, 0x34, 0x12),
+    (&ByteBuffer::writeUInt16BE, &ByteBuffer::readUInt16BE, 0xABCD, 0xAB, 0xCD)
 ) {
     uint8_t raw[4] = {};
     ByteBuffer bb{raw, sizeof(raw)};
@@ -122,8 +127,8 @@ TEMPLATE_TEST_CASE_SIG(
     "32-bit LE/BE read+write with cursors", "[ByteBuffer][32bit]",
     ((auto writeFn, auto readFn, uint32_t value, uint8_t b0, uint8_t b1, uint8_t b2, uint8_t b3),
      writeFn, readFn, value, b0, b1, b2, b3),
-    (ByteBuffer::writeUInt32LE, ByteBuffer::readUInt32LE, 0x11223344, 0x44, 0x33, 0x22, 0x11),
-    (ByteBuffer::writeUInt32BE, ByteBuffer::readUInt32BE, 0xDEADBEEF, 0xDE, 0xAD, 0xBE, 0xEF)
+    (&ByteBuffer::writeUInt32LE, &ByteBuffer::readUInt32LE, 0x11223344, 0x44, 0x33, 0x22, 0x11),
+    (&ByteBuffer::writeUInt32BE, &ByteBuffer::readUInt32BE, 0xDEADBEEF, 0xDE, 0xAD, 0xBE, 0xEF)
 ) {
     uint8_t raw[8] = {};
     ByteBuffer bb{raw, sizeof(raw)};
@@ -201,3 +206,362 @@ TEST_CASE_METHOD(ByteBufferFixture, "ResetRead / ResetWrite behavior", "[ByteBuf
     REQUIRE(bb.writeRemaining() == bb.capacity());
     REQUIRE(bb.readRemaining()  == 0);
 }
+
+TEST_CASE("writeBytes / readBytes move a block with one bounds check", "[ByteBuffer][Bulk]") {
+    uint8_t raw[8] = {};
+    ByteBuffer bb{raw, sizeof(raw)};
+    const uint8_t src[6] = {1, 2, 3, 4, 5, 6};
+
+    REQUIRE(bb.writeBytes(src, 6));
+    REQUIRE(bb.writePosition() == 6);
+    REQUIRE_FALSE(bb.writeBytes(src, 3));   // all-or-nothing
+    REQUIRE(bb.writePosition() == 6);
+    REQUIRE(bb.writeBytes(src, 0));
+
+    uint8_t dst[6] = {};
+    REQUIRE_FALSE(bb.readBytes(dst, 7));
+    REQUIRE(bb.readPosition() == 0);
+    REQUIRE(bb.readBytes(dst, 6));
+    for (int i = 0; i < 6; ++i) CHECK(dst[i] == src[i]);
+}
+
+TEMPLATE_TEST_CASE_SIG(
+    "Array codecs match the scalar accessors", "[ByteBuffer][Array]",
+    ((typename V, auto writeArr, auto readArr, auto writeOne, auto readOne),
+     V, writeArr, readArr, writeOne, readOne),
+    (uint16_t, &ByteBuffer::writeUInt16ArrayLE, &ByteBuffer::readUInt16ArrayLE,
+               &ByteBuffer::writeUInt16LE, &ByteBuffer::readUInt16LE),
+    (uint16_t, &ByteBuffer::writeUInt16ArrayBE, &ByteBuffer::readUInt16ArrayBE,
+               &ByteBuffer::writeUInt16BE, &ByteBuffer::readUInt16BE),
+    (uint32_t, &ByteBuffer::writeUInt32ArrayLE, &ByteBuffer::readUInt32ArrayLE,
+               &ByteBuffer::writeUInt32LE, &ByteBuffer::readUInt32LE),
+    (uint32_t, &ByteBuffer::writeUInt32ArrayBE, &ByteBuffer::readUInt32ArrayBE,
+               &ByteBuffer::writeUInt32BE, &ByteBuffer::readUInt32BE)
+) {
+    // Cover every length around the 16- and 32-byte SIMD blocks.
+    for (size_t count = 0; count <= 40; ++count) {
+        V values[40];
+        for (size_t i = 0; i < count; ++i) values[i] = V(0x01020304u * (i + 1) + 0x0A0B);
+
+        uint8_t bulk[40 * sizeof(V)] = {}, single[40 * sizeof(V)] = {};
+        ByteBuffer a{bulk, count * sizeof(V)};
+        ByteBuffer b{single, count * sizeof(V)};
+        REQUIRE((a.*writeArr)(values, count));
+        for (size_t i = 0; i < count; ++i) REQUIRE((b.*writeOne)(values[i]));
+        REQUIRE(a.writePosition() == b.writePosition());
+        REQUIRE(std::equal(bulk, bulk + count * sizeof(V), single));
+        REQUIRE_FALSE((a.*writeArr)(values, 1));
+
+        V back[40] = {};
+        REQUIRE((a.*readArr)(back, count));
+        REQUIRE(std::equal(back, back + count, values));
+        REQUIRE_FALSE((a.*readArr)(back, 1));
+
+        V one = 0;
+        if (count) {
+            b.resetRead();
+            REQUIRE((b.*readOne)(one));
+            REQUIRE(one == values[0]);
+        }
+    }
+}
+
+TEST_CASE("Generic read<V, Endian> / write<V, Endian> core", "[ByteBuffer][Generic]") {
+    using antBuffers::Endian;
+    uint8_t raw[16] = {};
+    ByteBuffer bb{raw, sizeof(raw)};
+
+    REQUIRE(bb.write<uint32_t, Endian::Big>(0x01020304u));
+    REQUIRE(bb.write<uint64_t, Endian::Little>(0x1122334455667788ull));
+    CHECK(raw[0] == 0x01);
+    CHECK(raw[3] == 0x04);
+    CHECK(raw[4] == 0x88);
+    CHECK(raw[11] == 0x11);
+    REQUIRE_FALSE(bb.write<uint64_t, Endian::Big>(0));   // only 4 bytes left
+    REQUIRE(bb.writePosition() == 12);
+
+    // Named accessors and the template agree on the encoding.
+    uint16_t a = 0;
+    REQUIRE(bb.readUInt16BE(a));
+    CHECK(a == 0x0102);
+    uint16_t b = 0;
+    REQUIRE(bb.read<uint16_t, Endian::Big>(b));
+    CHECK(b == 0x0304);
+    uint64_t c = 0;
+    REQUIRE(bb.read<uint64_t, Endian::Little>(c));
+    CHECK(c == 0x1122334455667788ull);
+    REQUIRE_FALSE(bb.read<uint8_t, Endian::Little>(raw[15]));
+}
+
+TEST_CASE("byteSwap reverses every width", "[ByteBuffer][Codec]") {
+    using antBuffers::detail::byteSwap;
+    CHECK(byteSwap(uint8_t(0xAB)) == 0xAB);
+    CHECK(byteSwap(uint16_t(0x1234)) == 0x3412);
+    CHECK(byteSwap(uint32_t(0x11223344u)) == 0x44332211u);
+    CHECK(byteSwap(uint64_t(0x0102030405060708ull)) == 0x0807060504030201ull);
+}
+
+TEST_CASE("64-bit, signed and floating-point accessors", "[ByteBuffer][Wide]") {
+    uint8_t raw[64] = {};
+    ByteBuffer bb{raw, sizeof(raw)};
+
+    REQUIRE(bb.writeUInt64LE(0x0102030405060708ull));
+    REQUIRE(bb.writeUInt64BE(0x0102030405060708ull));
+    CHECK(raw[0] == 0x08);
+    CHECK(raw[7] == 0x01);
+    CHECK(raw[8] == 0x01);
+    CHECK(raw[15] == 0x08);
+
+    REQUIRE(bb.writeInt8(-2));
+    REQUIRE(bb.writeInt16BE(-2));
+    REQUIRE(bb.writeInt32LE(-123456));
+    REQUIRE(bb.writeInt64BE(INT64_MIN));
+    CHECK(raw[16] == 0xFE);
+    CHECK(raw[17] == 0xFF);
+    CHECK(raw[18] == 0xFE);
+    CHECK(raw[23] == 0x80);
+
+    REQUIRE(bb.writeFloat32BE(1.0f));
+    REQUIRE(bb.writeFloat64LE(-0.1));
+    CHECK(raw[31] == 0x3F);   // 1.0f = 0x3F800000
+    CHECK(raw[32] == 0x80);
+    REQUIRE(bb.writePosition() == 43);
+
+    uint64_t u = 0;
+    REQUIRE(bb.readUInt64LE(u));
+    CHECK(u == 0x0102030405060708ull);
+    REQUIRE(bb.readUInt64BE(u));
+    CHECK(u == 0x0102030405060708ull);
+    int8_t i8 = 0;
+    int16_t i16 = 0;
+    int32_t i32 = 0;
+    int64_t i64 = 0;
+    REQUIRE(bb.readInt8(i8));
+    REQUIRE(bb.readInt16BE(i16));
+    REQUIRE(bb.readInt32LE(i32));
+    REQUIRE(bb.readInt64BE(i64));
+    CHECK(i8 == -2);
+    CHECK(i16 == -2);
+    CHECK(i32 == -123456);
+    CHECK(i64 == INT64_MIN);
+    float f = 0;
+    double d = 0;
+    REQUIRE(bb.readFloat32BE(f));
+    REQUIRE(bb.readFloat64LE(d));
+    CHECK(f == 1.0f);
+    CHECK(d == -0.1);
+    REQUIRE_FALSE(bb.readUInt64LE(u));
+
+    // Eight bytes needed, seven left: nothing is written.
+    ByteBuffer small{raw, 7};
+    REQUIRE_FALSE(small.writeFloat64BE(1.0));
+    REQUIRE_FALSE(small.writeInt64LE(1));
+    REQUIRE(small.writePosition() == 0);
+}
+
+TEST_CASE("Float16 pack/unpack", "[ByteBuffer][Float16]") {
+    using antBuffers::detail::floatToHalf;
+    using antBuffers::detail::halfToFloat;
+
+    CHECK(floatToHalf(1.0f) == 0x3C00);
+    CHECK(floatToHalf(-2.0f) == 0xC000);
+    CHECK(floatToHalf(65504.0f) == 0x7BFF);
+    CHECK(floatToHalf(65520.0f) == 0x7C00);          // rounds up to infinity
+    CHECK(floatToHalf(1e9f) == 0x7C00);
+    CHECK(floatToHalf(5.9604645e-8f) == 0x0001);     // smallest subnormal
+    CHECK(floatToHalf(2.0e-8f) == 0x0000);           // below half of it
+    CHECK(floatToHalf(-0.0f) == 0x8000);
+    CHECK(floatToHalf(1.0f + 1.0f / 2048) == 0x3C00); // tie, rounds to even
+    CHECK(floatToHalf(1.0f + 3.0f / 2048) == 0x3C02); // tie, rounds to even
+    CHECK((floatToHalf(std::numeric_limits<float>::quiet_NaN()) & 0x7C00) == 0x7C00);
+    CHECK((floatToHalf(std::numeric_limits<float>::quiet_NaN()) & 0x03FF) != 0);
+
+    // Every non-NaN half survives widening and narrowing unchanged.
+    for (uint32_t h = 0; h <= 0xFFFF; ++h) {
+        const uint16_t bits = uint16_t(h);
+        const bool nan = (bits & 0x7C00) == 0x7C00 && (bits & 0x03FF);
+        if (nan) {
+            REQUIRE(std::isnan(halfToFloat(bits)));
+            continue;
+        }
+        REQUIRE(floatToHalf(halfToFloat(bits)) == bits);
+    }
+    CHECK(halfToFloat(0x0001) == 5.9604645e-8f);
+    CHECK(halfToFloat(0x3555) == Approx(0.33325195f));
+    CHECK(std::isinf(halfToFloat(0xFC00)));
+
+    uint8_t raw[4] = {};
+    ByteBuffer bb{raw, sizeof(raw)};
+    REQUIRE(bb.writeFloat16LE(1.5f));
+    REQUIRE(bb.writeFloat16BE(-0.25f));
+    REQUIRE_FALSE(bb.writeFloat16LE(0.0f));
+    CHECK(raw[0] == 0x00);
+    CHECK(raw[1] == 0x3E);
+    CHECK(raw[2] == 0xB4);
+    CHECK(raw[3] == 0x00);
+    float a = 0;
+    float b = 0;
+    REQUIRE(bb.readFloat16LE(a));
+    REQUIRE(bb.readFloat16BE(b));
+    CHECK(a == 1.5f);
+    CHECK(b == -0.25f);
+    REQUIRE_FALSE(bb.readFloat16LE(a));
+}
+
+TEST_CASE("LEB128 varints and ZigZag", "[ByteBuffer][Varint]") {
+    uint8_t raw[32] = {};
+    ByteBuffer bb{raw, sizeof(raw)};
+
+    REQUIRE(bb.writeVarUInt(0));
+    REQUIRE(bb.writeVarUInt(127));
+    REQUIRE(bb.writeVarUInt(300));
+    REQUIRE(bb.writeVarUInt(UINT64_MAX));
+    REQUIRE(bb.writePosition() == 1 + 1 + 2 + 10);
+    CHECK(raw[1] == 0x7F);
+    CHECK(raw[2] == 0xAC);
+    CHECK(raw[3] == 0x02);
+    CHECK(raw[13] == 0x01);
+
+    REQUIRE(bb.writeVarInt(0));
+    REQUIRE(bb.writeVarInt(-1));
+    REQUIRE(bb.writeVarInt(63));
+    REQUIRE(bb.writeVarInt(-64));
+    REQUIRE(bb.writeVarInt(INT64_MIN));
+    CHECK(raw[14] == 0x00);
+    CHECK(raw[15] == 0x01);
+    CHECK(raw[16] == 0x7E);
+    CHECK(raw[17] == 0x7F);
+    REQUIRE(bb.writePosition() == 28);
+    REQUIRE_FALSE(bb.writeVarUInt(1ull << 28));   // needs 5 bytes, 4 left
+    REQUIRE(bb.writePosition() == 28);
+
+    uint64_t u = 1;
+    REQUIRE(bb.readVarUInt(u));
+    CHECK(u == 0);
+    REQUIRE(bb.readVarUInt(u));
+    CHECK(u == 127);
+    REQUIRE(bb.readVarUInt(u));
+    CHECK(u == 300);
+    REQUIRE(bb.readVarUInt(u));
+    CHECK(u == UINT64_MAX);
+    int64_t s = 1;
+    for (int64_t expected : {int64_t(0), int64_t(-1), int64_t(63), int64_t(-64), INT64_MIN}) {
+        REQUIRE(bb.readVarInt(s));
+        CHECK(s == expected);
+    }
+    REQUIRE_FALSE(bb.readVarUInt(u));
+
+    // Truncated and overlong encodings consume nothing.
+    const uint8_t truncated[] = {0x80, 0x80};
+    uint8_t t[sizeof(truncated)];
+    ByteBuffer tb{t, sizeof(t)};
+    REQUIRE(tb.writeBytes(truncated, sizeof(truncated)));
+    REQUIRE_FALSE(tb.readVarUInt(u));
+    REQUIRE(tb.readPosition() == 0);
+
+    uint8_t overlong[11];
+    std::fill(overlong, overlong + 9, 0xFF);
+    overlong[9] = 0x02;   // bit 64
+    overlong[10] = 0x00;
+    uint8_t o[sizeof(overlong)];
+    ByteBuffer ob{o, sizeof(o)};
+    REQUIRE(ob.writeBytes(overlong, sizeof(overlong)));
+    REQUIRE_FALSE(ob.readVarUInt(u));
+    REQUIRE(ob.readPosition() == 0);
+}
+
+TEST_CASE("readVarUIntArray matches the scalar decoder", "[ByteBuffer][Varint]") {
+    std::mt19937 rng(7);
+    // Value ranges: all one byte, up to two bytes, then mixed lengths up to five.
+    const uint32_t limits[] = {0x7F, 0x3FFF, 0xFFFFFFFFu};
+    for (uint32_t limit : limits) {
+        std::vector<uint32_t> values(1000);
+        std::uniform_int_distribution<uint32_t> dist(0, limit);
+        for (auto &v : values) v = (limit == 0xFFFFFFFFu) ? dist(rng) >> (rng() % 32) : dist(rng);
+
+        std::vector<uint8_t> raw(values.size() * 5);
+        ByteBuffer bb{raw.data(), raw.size()};
+        for (uint32_t v : values) REQUIRE(bb.writeVarUInt(v));
+        const size_t encoded = bb.writePosition();
+
+        std::vector<uint32_t> out(values.size());
+        REQUIRE(bb.readVarUIntArray(out.data(), out.size()));
+        REQUIRE(bb.readPosition() == encoded);
+        REQUIRE(out == values);
+
+        // One byte short: fails without consuming anything.
+        std::vector<uint8_t> copy(encoded - 1);
+        ByteBuffer shortBuf{copy.data(), copy.size()};
+        REQUIRE(shortBuf.writeBytes(raw.data(), copy.size()));
+        REQUIRE_FALSE(shortBuf.readVarUIntArray(out.data(), out.size()));
+        REQUIRE(shortBuf.readPosition() == 0);
+    }
+
+    // A value above 32 bits is rejected.
+    uint8_t raw[64] = {};
+    ByteBuffer bb{raw, sizeof(raw)};
+    for (int i = 0; i < 20; ++i) bb.writeVarUInt(1);
+    bb.writeVarUInt(1ull << 32);
+    uint32_t out[21];
+    REQUIRE_FALSE(bb.readVarUIntArray(out, 21));
+    REQUIRE(bb.readPosition() == 0);
+    REQUIRE(bb.readVarUIntArray(out, 20));
+    REQUIRE(out[19] == 1);
+}
+
+TEST_CASE("beginRecord / endRecord with a sticky-error RecordWriter", "[ByteBuffer][Record]") {
+    uint8_t raw[24] = {};
+    ByteBuffer bb{raw, sizeof(raw)};
+    REQUIRE(bb.writeUInt8(0xAA));
+
+    // Same bytes as the checked accessors.
+    antBuffers::RecordWriter w = bb.beginRecord(15);
+    REQUIRE(w.ok());
+    w.putUInt8(1).putUInt16BE(0x0203).putInt32LE(-2).putFloat64BE(1.0);
+    REQUIRE(w.size() == 15);
+    REQUIRE(bb.writePosition() == 1);   // nothing visible until endRecord()
+    REQUIRE(bb.endRecord(w));
+    REQUIRE(bb.writePosition() == 16);
+
+    uint8_t reference[16] = {};
+    ByteBuffer ref{reference, sizeof(reference)};
+    ref.writeUInt8(0xAA);
+    ref.writeUInt8(1);
+    ref.writeUInt16BE(0x0203);
+    ref.writeInt32LE(-2);
+    ref.writeFloat64BE(1.0);
+    REQUIRE(std::equal(raw, raw + 16, reference));
+
+    // Variable-length tail reserved with ensure().
+    const uint8_t payload[3] = {7, 8, 9};
+    antBuffers::RecordWriter v = bb.beginRecord(1);
+    v.putUInt8(3).ensure(3).putBytes(payload, 3).ensure(2).putVarUInt(300);
+    REQUIRE(bb.endRecord(v));
+    REQUIRE(bb.writePosition() == 22);
+    CHECK(raw[19] == 9);
+    CHECK(raw[20] == 0xAC);
+
+    // A failed reservation is sticky: every later put is dropped and the
+    // buffer is untouched.
+    antBuffers::RecordWriter f = bb.beginRecord(4);
+    REQUIRE_FALSE(f.ok());
+    f.putUInt16LE(0xFFFF).ensure(0).putUInt16LE(0xFFFF);
+    REQUIRE_FALSE(f.ok());
+    REQUIRE(f.size() == 0);
+    REQUIRE_FALSE(bb.endRecord(f));
+    REQUIRE(bb.writePosition() == 22);
+    CHECK(raw[22] == 0);
+
+    antBuffers::RecordWriter late = bb.beginRecord(2);
+    late.putUInt8(1).ensure(2);
+    REQUIRE_FALSE(late.ok());
+    REQUIRE_FALSE(bb.endRecord(late));
+    REQUIRE(bb.writePosition() == 22);
+
+    // A record is stale once the buffer is written to directly.
+    antBuffers::RecordWriter stale = bb.beginRecord(1);
+    stale.putUInt8(5);
+    REQUIRE(bb.writeUInt8(6));
+    REQUIRE_FALSE(bb.endRecord(stale));
+    REQUIRE(bb.writePosition() == 23);
+}
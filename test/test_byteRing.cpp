@@ -0,0 +1,97 @@
+#define CATCH_CONFIG_MAIN
+#include <catch.hpp>
+#include "byte_ring.h"
+#include <cstdint>
+
+using antBuffers::ByteRing;
+
+/**
+ * @brief Fixture providing a 7-byte ring, so 16- and 32-bit values straddle the wrap.
+ */
+struct ByteRingFixture {
+    static constexpr size_t SIZE = 7;
+    uint8_t raw[SIZE] = {};
+    ByteRing br{raw, SIZE};
+};
+
+TEST_CASE_METHOD(ByteRingFixture, "Initial state", "[ByteRing][Init]") {
+    REQUIRE(br.capacity() == SIZE);
+    REQUIRE(br.readRemaining() == 0);
+    REQUIRE(br.writeRemaining() == SIZE);
+}
+
+TEST_CASE_METHOD(ByteRingFixture, "reading frees space for writing", "[ByteRing][Stream]") {
+    for (uint8_t i = 0; i < SIZE; ++i) REQUIRE(br.writeUInt8(i));
+    REQUIRE_FALSE(br.writeUInt8(0xFF));
+
+    uint8_t v;
+    for (int round = 0; round < 20; ++round) {
+        REQUIRE(br.readUInt8(v));
+        REQUIRE(br.writeUInt8(uint8_t(SIZE + round)));
+        REQUIRE(br.writeRemaining() == 0);
+    }
+    for (uint8_t i = 20; i < 20 + SIZE; ++i) {
+        REQUIRE(br.readUInt8(v));
+        REQUIRE(v == i);
+    }
+    REQUIRE_FALSE(br.readUInt8(v));
+}
+
+TEST_CASE_METHOD(ByteRingFixture, "typed values straddling the wrap point", "[ByteRing][Wrap]") {
+    // Start every iteration at a different offset so each value crosses the end at some point.
+    for (size_t shift = 0; shift < SIZE; ++shift) {
+        br.clear();
+        for (size_t i = 0; i < shift; ++i) br.writeUInt8(0);
+        REQUIRE(br.discard(shift));
+
+        REQUIRE(br.writeUInt16LE(0xBEEF));
+        REQUIRE(br.writeUInt32BE(0x11223344));
+        uint16_t v16; uint32_t v32;
+        REQUIRE(br.readUInt16LE(v16)); REQUIRE(v16 == 0xBEEF);
+        REQUIRE(br.readUInt32BE(v32)); REQUIRE(v32 == 0x11223344);
+
+        REQUIRE(br.writeUInt16BE(0x0102));
+        REQUIRE(br.writeUInt32LE(0xA1B2C3D4));
+        REQUIRE(br.readUInt16BE(v16)); REQUIRE(v16 == 0x0102);
+        REQUIRE(br.readUInt32LE(v32)); REQUIRE(v32 == 0xA1B2C3D4);
+        REQUIRE(br.readRemaining() == 0);
+    }
+}
+
+TEST_CASE_METHOD(ByteRingFixture, "peek does not consume, discard does", "[ByteRing][Peek]") {
+    const uint8_t frame[5] = {1, 2, 3, 4, 5};
+    br.writeUInt8(0);
+    br.writeUInt8(0);
+    br.writeUInt8(0);
+    br.discard(3);
+    REQUIRE(br.writeBytes(frame, 5));  // wraps
+
+    uint8_t out[5] = {};
+    REQUIRE(br.peek(out, 2, 3));
+    REQUIRE(out[0] == 4);
+    REQUIRE(out[1] == 5);
+    REQUIRE_FALSE(br.peek(out, 3, 3));
+    REQUIRE(br.readRemaining() == 5);
+
+    REQUIRE(br.discard(1));
+    REQUIRE(br.readBytes(out, 4));
+    REQUIRE(out[0] == 2);
+    REQUIRE(out[3] == 5);
+    REQUIRE_FALSE(br.discard(1));
+}
+
+TEST_CASE_METHOD(ByteRingFixture, "all-or-nothing bulk and typed transfers", "[ByteRing][Overflow]") {
+    const uint8_t data[8] = {};
+    REQUIRE_FALSE(br.writeBytes(data, 8));
+    REQUIRE(br.readRemaining() == 0);
+    REQUIRE(br.writeBytes(data, 5));
+    REQUIRE_FALSE(br.writeUInt32LE(1));
+    REQUIRE(br.writeUInt16LE(1));
+
+    uint8_t out[8];
+    REQUIRE_FALSE(br.readBytes(out, 8));
+    REQUIRE(br.readRemaining() == 7);
+    br.clear();
+    uint16_t v;
+    REQUIRE_FALSE(br.readUInt16BE(v));
+}
@@ -0,0 +1,44 @@
+#define CATCH_CONFIG_MAIN
+#include <catch.hpp>
+#include "latency_histogram.h"
+#include <cstdint>
+
+using antBuffers::LatencyHistogram;
+
+// 1) Small values are exact, large ones keep their relative precision
+TEST_CASE("bucket bounds bracket every value", "[LatencyHistogram][Buckets]") {
+    using H = LatencyHistogram<4>;
+    for (uint64_t v = 0; v < 16; ++v) REQUIRE(H::indexOf(v) == v);
+    const uint64_t samples[] = {16, 17, 31, 32, 33, 1000, 123456789, UINT64_MAX};
+    for (uint64_t v : samples) {
+        const size_t i = H::indexOf(v);
+        REQUIRE(i < H::bucketCount);
+        REQUIRE(H::lowestIn(i) <= v);
+        REQUIRE(H::highestIn(i) >= v);
+        // Bucket width is at most 1/16 of its lower bound.
+        REQUIRE(H::highestIn(i) - H::lowestIn(i) <= H::lowestIn(i) / 16);
+    }
+    REQUIRE(H::indexOf(UINT64_MAX) == H::bucketCount - 1);
+}
+
+// 2) Percentiles
+TEST_CASE("percentile() walks the cumulative counts", "[LatencyHistogram][Percentile]") {
+    LatencyHistogram<> h;
+    REQUIRE(h.percentile(50) == 0);
+    for (uint64_t v = 1; v <= 100; ++v) h.record(v);
+    h.record(100000);
+
+    REQUIRE(h.count() == 101);
+    REQUIRE(h.max() == 100000);
+    REQUIRE(h.percentile(0) == 1);
+    const uint64_t p50 = h.percentile(50);
+    REQUIRE(p50 >= 51);
+    REQUIRE(p50 <= 51 + 51 / 16);
+    REQUIRE(h.percentile(99) >= 100);
+    REQUIRE(h.percentile(99) < 110);
+    REQUIRE(h.percentile(100) == 100000);   // clamped to the exact max
+
+    h.reset();
+    REQUIRE(h.count() == 0);
+    REQUIRE(h.max() == 0);
+}
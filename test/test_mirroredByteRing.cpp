@@ -0,0 +1,86 @@
+#define CATCH_CONFIG_MAIN
+#include <catch.hpp>
+#include "mirrored_byte_ring.h"
+#include <cstdint>
+#include <cstring>
+#include <utility>
+
+#if defined(__linux__)
+using antBuffers::MirroredByteRing;
+
+// 1) Capacity rounding and initial state
+TEST_CASE("capacity is rounded up to a page-sized power of two", "[MirroredByteRing][Init]") {
+    MirroredByteRing ring(100);
+    REQUIRE(ring.valid());
+    REQUIRE(ring.capacity() >= 100);
+    REQUIRE((ring.capacity() & (ring.capacity() - 1)) == 0);
+    REQUIRE(ring.readRemaining() == 0);
+    REQUIRE(ring.writeRemaining() == ring.capacity());
+}
+
+// 2) Both halves alias the same memory
+TEST_CASE("second mapping mirrors the first", "[MirroredByteRing][Mirror]") {
+    MirroredByteRing ring(1);
+    uint8_t *w = ring.writePtr();
+    w[0] = 0xAB;
+    REQUIRE(w[ring.capacity()] == 0xAB);
+    w[ring.capacity() + 1] = 0xCD;
+    REQUIRE(w[1] == 0xCD);
+}
+
+// 3) Typed accessors, including values that straddle the end of storage
+TEST_CASE("typed values across the wrap point read back contiguously", "[MirroredByteRing][Wrap]") {
+    MirroredByteRing ring(1);
+    const size_t cap = ring.capacity();
+
+    // Leave the cursors three bytes before the end of the first mapping.
+    REQUIRE(ring.commit(cap - 3));
+    REQUIRE(ring.consume(cap - 3));
+
+    REQUIRE(ring.writeUInt32BE(0x11223344));
+    REQUIRE(ring.writeUInt16LE(0xBEEF));
+    REQUIRE(ring.writeUInt32LE(0xA1B2C3D4));
+    REQUIRE(ring.writeUInt16BE(0x0102));
+    REQUIRE(ring.writeUInt8(0x7F));
+
+    // The whole region is readable as one range despite the wrap.
+    REQUIRE(ring.readRemaining() == 13);
+    const uint8_t expectedBytes[4] = {0x11, 0x22, 0x33, 0x44};
+    REQUIRE(std::memcmp(ring.readPtr(), expectedBytes, 4) == 0);
+
+    uint32_t v32; uint16_t v16; uint8_t v8;
+    REQUIRE(ring.readUInt32BE(v32)); REQUIRE(v32 == 0x11223344);
+    REQUIRE(ring.readUInt16LE(v16)); REQUIRE(v16 == 0xBEEF);
+    REQUIRE(ring.readUInt32LE(v32)); REQUIRE(v32 == 0xA1B2C3D4);
+    REQUIRE(ring.readUInt16BE(v16)); REQUIRE(v16 == 0x0102);
+    REQUIRE(ring.readUInt8(v8));     REQUIRE(v8 == 0x7F);
+    REQUIRE_FALSE(ring.readUInt8(v8));
+}
+
+// 4) Overflow and underflow
+TEST_CASE("writes fail when full and reads fail when empty", "[MirroredByteRing][Overflow]") {
+    MirroredByteRing ring(1);
+    REQUIRE(ring.commit(ring.capacity() - 1));
+    REQUIRE_FALSE(ring.writeUInt16LE(1));
+    REQUIRE(ring.writeUInt8(1));
+    REQUIRE_FALSE(ring.writeUInt8(1));
+    REQUIRE_FALSE(ring.commit(1));
+
+    ring.clear();
+    uint16_t v;
+    REQUIRE_FALSE(ring.readUInt16BE(v));
+    REQUIRE_FALSE(ring.consume(1));
+}
+
+// 5) Ownership moves with the object
+TEST_CASE("move transfers the mapping", "[MirroredByteRing][Move]") {
+    MirroredByteRing a(1);
+    REQUIRE(a.writeUInt32LE(42));
+    MirroredByteRing b(std::move(a));
+    REQUIRE_FALSE(a.valid());
+    REQUIRE(a.capacity() == 0);
+    uint32_t v;
+    REQUIRE(b.readUInt32LE(v));
+    REQUIRE(v == 42);
+}
+#endif
@@ -0,0 +1,193 @@
+#define CATCH_CONFIG_MAIN
+#include <catch.hpp>
+#include "mpmc_ring_buffer.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <thread>
+#include <vector>
+
+using antBuffers::MpmcRingBuffer;
+
+// 1) Capacity and initial state
+TEST_CASE("capacity() and initial state", "[MpmcRingBuffer][State]") {
+    MpmcRingBuffer<int, 4> rb;
+    REQUIRE(rb.capacity() == 4);
+    REQUIRE(rb.empty());
+    REQUIRE_FALSE(rb.full());
+    REQUIRE(rb.size() == 0);
+}
+
+// 2) Push until full, pop until empty
+TEST_CASE("push succeeds until full and pop until empty", "[MpmcRingBuffer][PushPop]") {
+    MpmcRingBuffer<int, 4> rb;
+    for (int i = 1; i <= 4; ++i) REQUIRE(rb.push(i));
+    REQUIRE(rb.full());
+    REQUIRE_FALSE(rb.push(5));
+
+    int v;
+    for (int i = 1; i <= 4; ++i) {
+        REQUIRE(rb.pop(v));
+        REQUIRE(v == i);
+    }
+    REQUIRE_FALSE(rb.pop(v));
+    REQUIRE(rb.empty());
+}
+
+// 3) Move-push semantics
+TEST_CASE("push(T&&) uses move semantics", "[MpmcRingBuffer][Move]") {
+    MpmcRingBuffer<std::string, 2> rb;
+    std::string foo = "foo";
+    REQUIRE(rb.push(std::move(foo)));
+    std::string popped;
+    REQUIRE(rb.pop(popped));
+    REQUIRE(popped == "foo");
+    REQUIRE(foo.empty());
+}
+
+// 4) Sequence numbers survive many laps
+TEST_CASE("slots are reused correctly across laps", "[MpmcRingBuffer][Wrap]") {
+    MpmcRingBuffer<int, 4> rb;
+    int next = 0;
+    int expected = 0;
+    for (int round = 0; round < 50; ++round) {
+        while (rb.push(next)) ++next;
+        REQUIRE(rb.size() == 4);
+        int v;
+        REQUIRE(rb.pop(v)); REQUIRE(v == expected++);
+        REQUIRE(rb.pop(v)); REQUIRE(v == expected++);
+        REQUIRE(rb.size() == 2);
+    }
+}
+
+namespace {
+/**
+ * @brief Run P producers and C consumers over one ring until every value has
+ *        been transferred.
+ *
+ * Producer p pushes (p << 32 | i) for i in [0, perProducer). Each consumer
+ * checks that values from the same producer arrive in increasing order and
+ * adds everything it sees to a checksum. Consumers pop one element at a
+ * time, or up to @p batch at once with pop_bulk() when @p batch > 1.
+ *
+ * @return Elapsed wall-clock seconds for the transfer.
+ */
+template<size_t N>
+double runTransfer(MpmcRingBuffer<uint64_t, N> &rb, unsigned producers, unsigned consumers,
+                   uint64_t perProducer, uint64_t &sum, bool &ordered, size_t batch = 1) {
+    std::atomic<uint64_t> popped{0};
+    std::atomic<uint64_t> total{0};
+    std::atomic<bool> inOrder{true};
+    const uint64_t expected = producers * perProducer;
+
+    const auto start = std::chrono::steady_clock::now();
+    std::vector<std::thread> threads;
+    for (unsigned p = 0; p < producers; ++p) {
+        threads.emplace_back([&, p] {
+            for (uint64_t i = 0; i < perProducer; ++i) {
+                const uint64_t v = (uint64_t(p) << 32) | i;
+                while (!rb.push(v)) std::this_thread::yield();
+            }
+        });
+    }
+    for (unsigned c = 0; c < consumers; ++c) {
+        threads.emplace_back([&] {
+            std::vector<int64_t> last(producers, -1);
+            std::vector<uint64_t> got(batch);
+            uint64_t local = 0;
+            while (popped.load(std::memory_order_relaxed) < expected) {
+                const size_t n = (batch > 1) ? rb.pop_bulk(got.data(), batch) : size_t(rb.pop(got[0]));
+                if (n == 0) { std::this_thread::yield(); continue; }
+                popped.fetch_add(n, std::memory_order_relaxed);
+                for (size_t k = 0; k < n; ++k) {
+                    const uint64_t v = got[k];
+                    const unsigned p = unsigned(v >> 32);
+                    const int64_t i = int64_t(v & 0xFFFFFFFFu);
+                    if (i <= last[p]) inOrder.store(false, std::memory_order_relaxed);
+                    last[p] = i;
+                    local += v;
+                }
+            }
+            total.fetch_add(local, std::memory_order_relaxed);
+        });
+    }
+    for (auto &t : threads) t.join();
+    const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+    sum = total.load();
+    ordered = inOrder.load();
+    return elapsed.count();
+}
+
+uint64_t expectedSum(unsigned producers, uint64_t perProducer) {
+    uint64_t sum = 0;
+    for (unsigned p = 0; p < producers; ++p) {
+        sum += (uint64_t(p) << 32) * perProducer + perProducer * (perProducer - 1) / 2;
+    }
+    return sum;
+}
+} // namespace
+
+// 5) Many producers, many consumers: nothing lost, duplicated or reordered per producer
+TEST_CASE("concurrent producers and consumers transfer every element once", "[MpmcRingBuffer][Threads]") {
+    constexpr uint64_t PER_PRODUCER = 50000;
+    const auto shape = GENERATE(std::make_pair(1u, 1u), std::make_pair(4u, 1u),
+                                std::make_pair(1u, 4u), std::make_pair(4u, 4u));
+    MpmcRingBuffer<uint64_t, 64> rb;
+
+    uint64_t sum;
+    bool ordered;
+    runTransfer(rb, shape.first, shape.second, PER_PRODUCER, sum, ordered);
+
+    INFO("producers=" << shape.first << " consumers=" << shape.second);
+    REQUIRE(ordered);
+    REQUIRE(sum == expectedSum(shape.first, PER_PRODUCER));
+    REQUIRE(rb.empty());
+}
+
+// 6) Throughput under contention (hidden; run with: test_mpmcRingBuffer "[benchmark]")
+TEST_CASE("throughput scales with thread pairs", "[.][benchmark][MpmcRingBuffer]") {
+    constexpr uint64_t TOTAL = 4000000;
+    const unsigned maxPairs = std::max(1u, std::thread::hardware_concurrency() / 2);
+
+    for (unsigned pairs = 1; pairs <= maxPairs; pairs *= 2) {
+        MpmcRingBuffer<uint64_t, 1024> rb;
+        const uint64_t perProducer = TOTAL / pairs;
+        uint64_t sum;
+        bool ordered;
+        const double secs = runTransfer(rb, pairs, pairs, perProducer, sum, ordered);
+        REQUIRE(sum == expectedSum(pairs, perProducer));
+        WARN(pairs << "P/" << pairs << "C: "
+             << uint64_t(double(perProducer * pairs) / secs) << " ops/s");
+    }
+}
+
+// 7) Bulk pop claims a run of published slots at once
+TEST_CASE("pop_bulk takes up to max elements in order", "[MpmcRingBuffer][Bulk]") {
+    MpmcRingBuffer<int, 8> rb;
+    int out[8];
+    REQUIRE(rb.pop_bulk(out, 8) == 0);
+    for (int round = 0; round < 10; ++round) {
+        for (int i = 0; i < 6; ++i) REQUIRE(rb.push(round * 6 + i));
+        REQUIRE(rb.pop_bulk(out, 4) == 4);
+        REQUIRE(rb.pop_bulk(out + 4, 8) == 2);
+        for (int i = 0; i < 6; ++i) REQUIRE(out[i] == round * 6 + i);
+        REQUIRE(rb.empty());
+    }
+}
+
+// 8) Bulk consumers racing single-element producers
+TEST_CASE("concurrent pop_bulk consumers transfer every element once", "[MpmcRingBuffer][Bulk][Threads]") {
+    constexpr uint64_t PER_PRODUCER = 50000;
+    MpmcRingBuffer<uint64_t, 64> rb;
+
+    uint64_t sum;
+    bool ordered;
+    runTransfer(rb, 4, 4, PER_PRODUCER, sum, ordered, 16);
+
+    REQUIRE(ordered);
+    REQUIRE(sum == expectedSum(4, PER_PRODUCER));
+    REQUIRE(rb.empty());
+}
@@ -0,0 +1,111 @@
+#define CATCH_CONFIG_MAIN
+#include <catch.hpp>
+#include "multicast_ring.h"
+#include <atomic>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+using antBuffers::MulticastRing;
+
+// 1) Every consumer sees every element
+TEST_CASE("each consumer reads every element in place", "[MulticastRing][Broadcast]") {
+    MulticastRing<int, 4> ring;
+    const int a = ring.addConsumer();
+    const int b = ring.addConsumer();
+    REQUIRE(ring.consumers() == 2);
+
+    REQUIRE(ring.push(1));
+    REQUIRE(ring.push(2));
+    REQUIRE(ring.available(a) == 2);
+    REQUIRE(&ring.peek(a) == &ring.peek(b));  // same slot, no copy
+
+    int v;
+    REQUIRE(ring.pop(a, v)); REQUIRE(v == 1);
+    REQUIRE(ring.pop(a, v)); REQUIRE(v == 2);
+    REQUIRE_FALSE(ring.pop(a, v));
+    REQUIRE(ring.pop(b, v)); REQUIRE(v == 1);
+}
+
+// 2) Producer gated by the slowest consumer
+TEST_CASE("producer waits for the slowest consumer", "[MulticastRing][Gating]") {
+    MulticastRing<int, 4> ring;
+    const int fast = ring.addConsumer();
+    const int slow = ring.addConsumer();
+    for (int i = 0; i < 4; ++i) REQUIRE(ring.push(i));
+    REQUIRE_FALSE(ring.push(4));
+
+    ring.release(fast, ring.available(fast));
+    REQUIRE_FALSE(ring.push(4));   // slow still holds every slot
+    REQUIRE(ring.available(slow) == 4);
+    ring.release(slow);
+    REQUIRE(ring.push(4));
+    REQUIRE_FALSE(ring.push(5));
+    REQUIRE(ring.available(fast) == 1);
+    REQUIRE(ring.available(slow) == 4);
+    REQUIRE(ring.peek(slow, 3) == 4);
+}
+
+// 3) Dependency barriers
+TEST_CASE("dependent consumer never passes its dependency", "[MulticastRing][Barrier]") {
+    MulticastRing<int, 8> ring;
+    const int decode = ring.addConsumer();
+    const int archive = ring.addConsumer({decode});
+    REQUIRE(ring.addConsumer({7}) == -1);  // unknown dependency
+
+    ring.push(1);
+    ring.push(2);
+    REQUIRE(ring.available(archive) == 0);
+    ring.release(decode);
+    REQUIRE(ring.available(archive) == 1);
+    int v;
+    REQUIRE(ring.pop(archive, v)); REQUIRE(v == 1);
+    REQUIRE_FALSE(ring.pop(archive, v));
+}
+
+// 4) Registration limit
+TEST_CASE("addConsumer fails past MaxConsumers", "[MulticastRing][Setup]") {
+    MulticastRing<int, 2, 2> ring;
+    REQUIRE(ring.addConsumer() == 0);
+    REQUIRE(ring.addConsumer() == 1);
+    REQUIRE(ring.addConsumer() == -1);
+}
+
+// 5) One producer, a pipeline and an independent consumer on separate threads
+TEST_CASE("pipeline of consumer threads over shared slots", "[MulticastRing][Threads]") {
+    constexpr uint32_t COUNT = 100000;
+    MulticastRing<uint32_t, 64> ring;
+    const int decode = ring.addConsumer();
+    const int archive = ring.addConsumer({decode});
+    const int alert = ring.addConsumer();
+    std::atomic<uint32_t> decoded{0};
+
+    auto run = [&](int id, bool checkBehindDecode, bool &ok) {
+        ok = true;
+        for (uint32_t expected = 0; expected < COUNT;) {
+            const size_t n = ring.available(id);
+            if (n == 0) { std::this_thread::yield(); continue; }
+            for (size_t k = 0; k < n; ++k, ++expected) {
+                ok = ok && ring.peek(id, k) == expected;
+                if (checkBehindDecode) ok = ok && expected < decoded.load();
+            }
+            if (id == decode) decoded.store(expected);
+            ring.release(id, n);
+        }
+    };
+
+    bool okDecode, okArchive, okAlert;
+    std::thread t1(run, decode, false, std::ref(okDecode));
+    std::thread t2(run, archive, true, std::ref(okArchive));
+    std::thread t3(run, alert, false, std::ref(okAlert));
+    for (uint32_t i = 0; i < COUNT; ++i) {
+        while (!ring.push(i)) std::this_thread::yield();
+    }
+    t1.join();
+    t2.join();
+    t3.join();
+
+    REQUIRE(okDecode);
+    REQUIRE(okArchive);
+    REQUIRE(okAlert);
+}
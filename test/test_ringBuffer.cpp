@@ -2,6 +2,7 @@
 #include <catch.hpp>
 #include "ring_buffer.h"
 #include <string>
+#include <cstdint>
 
 using antBuffers::RingBuffer;
 
@@ -83,3 +84,342 @@ TEST_CASE("clear() empties buffer and resets indices", "[RingBuffer][Clear]") {
     REQUIRE(rb.size() == 0);
     REQUIRE(rb.push(7));  // buffer reusable after clear
 }
+
+// 9) Counter arithmetic wraps for both the masked and the general path
+TEMPLATE_TEST_CASE_SIG("counters wrap around over many laps", "[RingBuffer][Wrap]",
+                       ((size_t N), N), (3), (4)) {
+    RingBuffer<int, N> rb;
+    int next = 0;
+    int expected = 0;
+    for (int round = 0; round < 50; ++round) {
+        while (rb.push(next)) ++next;
+        REQUIRE(rb.size() == N);
+        REQUIRE(rb.full());
+        int v;
+        REQUIRE(rb.pop(v)); REQUIRE(v == expected++);
+        REQUIRE(rb.pop(v)); REQUIRE(v == expected++);
+        REQUIRE(rb.size() == N - 2);
+    }
+}
+
+// 10) No element count is stored alongside the counters
+TEST_CASE("object holds only storage and two counters", "[RingBuffer][Layout]") {
+    STATIC_REQUIRE(sizeof(RingBuffer<uint32_t, 16>) == 16 * sizeof(uint32_t) + 2 * sizeof(size_t));
+}
+
+// 11) Rounded capacity
+TEST_CASE("Pow2RingBuffer rounds capacity up to a power of two", "[RingBuffer][Capacity]") {
+    antBuffers::Pow2RingBuffer<int, 5> rb5;
+    antBuffers::Pow2RingBuffer<int, 8> rb8;
+    antBuffers::Pow2RingBuffer<int, 1> rb1;
+    REQUIRE(rb5.capacity() == 8);
+    REQUIRE(rb8.capacity() == 8);
+    REQUIRE(rb1.capacity() == 1);
+
+    antBuffers::Pow2RingBuffer<int, 5, antBuffers::RingStats<>> stats;
+    REQUIRE(stats.capacity() == 8);
+    for (int i = 0; i < 9; ++i) stats.push(i);
+    REQUIRE(stats.stats().snapshot().pushes == 8);
+    REQUIRE(stats.stats().snapshot().rejectedPushes == 1);
+}
+
+// 12) Bulk push/pop clamp to free space and stored elements
+TEST_CASE("push_bulk/pop_bulk move as many elements as fit", "[RingBuffer][Bulk]") {
+    RingBuffer<int, 4> rb;
+    const int in[6] = {1, 2, 3, 4, 5, 6};
+    REQUIRE(rb.push_bulk(in, 6) == 4);
+    REQUIRE(rb.full());
+    REQUIRE(rb.push_bulk(in, 1) == 0);
+
+    int out[6] = {};
+    REQUIRE(rb.pop_bulk(out, 6) == 4);
+    REQUIRE(out[0] == 1); REQUIRE(out[3] == 4);
+    REQUIRE(rb.empty());
+    REQUIRE(rb.pop_bulk(out, 1) == 0);
+}
+
+// 13) Bulk transfers split correctly at the wrap point
+TEMPLATE_TEST_CASE_SIG("bulk transfers across the wrap point", "[RingBuffer][Bulk]",
+                       ((size_t N), N), (5), (8)) {
+    RingBuffer<uint32_t, N> rb;
+    uint32_t next = 0;
+    uint32_t expected = 0;
+    for (int round = 0; round < 20; ++round) {
+        uint32_t in[N];
+        for (size_t i = 0; i < N; ++i) in[i] = next + uint32_t(i);
+        next += uint32_t(rb.push_bulk(in, N - 1));
+
+        uint32_t out[N];
+        const size_t got = rb.pop_bulk(out, 3);
+        REQUIRE(got == 3);
+        for (size_t i = 0; i < got; ++i) REQUIRE(out[i] == expected++);
+
+        // Interleave single-element ops so the bulk start slot keeps moving.
+        uint32_t v;
+        REQUIRE(rb.pop(v)); REQUIRE(v == expected++);
+    }
+    uint32_t rest[N];
+    const size_t left = rb.pop_bulk(rest, N);
+    for (size_t i = 0; i < left; ++i) REQUIRE(rest[i] == expected++);
+    REQUIRE(expected == next);
+}
+
+// 14) Non-trivially-copyable types take the element-wise path
+TEST_CASE("bulk transfers of std::string", "[RingBuffer][Bulk]") {
+    RingBuffer<std::string, 3> rb;
+    const std::string in[2] = {"a", "b"};
+    std::string out[3];
+    REQUIRE(rb.push_bulk(in, 2) == 2);
+    REQUIRE(rb.pop_bulk(out, 1) == 1);
+    REQUIRE(rb.push_bulk(in, 2) == 2);   // wraps
+    REQUIRE(rb.pop_bulk(out, 3) == 3);
+    REQUIRE(out[0] == "b");
+    REQUIRE(out[1] == "a");
+    REQUIRE(out[2] == "b");
+}
+
+namespace {
+/** @brief Element type that counts live instances and has no default constructor. */
+struct Tracked {
+    static int live;
+    int value;
+    explicit Tracked(int v) : value(v) { ++live; }
+    Tracked(const Tracked& o) : value(o.value) { ++live; }
+    Tracked(Tracked&& o) noexcept : value(o.value) { ++live; }
+    Tracked& operator=(const Tracked&) = default;
+    Tracked& operator=(Tracked&&) = default;
+    ~Tracked() { --live; }
+};
+int Tracked::live = 0;
+} // namespace
+
+// 15) Storage is uninitialized: only pushed elements are alive
+TEST_CASE("emplace constructs in place and pop/clear destroy", "[RingBuffer][Emplace]") {
+    Tracked::live = 0;
+    {
+        RingBuffer<Tracked, 4> rb;
+        REQUIRE(Tracked::live == 0);
+        REQUIRE(rb.emplace(1));
+        REQUIRE(rb.emplace(2));
+        REQUIRE(rb.emplace(3));
+        REQUIRE(Tracked::live == 3);
+
+        Tracked out(0);
+        REQUIRE(rb.pop(out));
+        REQUIRE(out.value == 1);
+        REQUIRE(Tracked::live == 3);  // out + two stored
+
+        rb.clear();
+        REQUIRE(Tracked::live == 1);
+        REQUIRE(rb.emplace(4));
+    }
+    REQUIRE(Tracked::live == 0);  // destructor released the stored element
+}
+
+// 16) Copy and move of the buffer itself
+TEST_CASE("copying and moving a RingBuffer transfers live elements", "[RingBuffer][Copy]") {
+    RingBuffer<std::string, 3> rb;
+    rb.push("a");
+    rb.push("b");
+    std::string v;
+    rb.pop(v);
+    rb.push("c");
+    rb.push("d");  // wrapped
+
+    RingBuffer<std::string, 3> copy(rb);
+    REQUIRE(copy.size() == 3);
+    RingBuffer<std::string, 3> moved(std::move(rb));
+    REQUIRE(rb.empty());
+    REQUIRE(moved.pop(v)); REQUIRE(v == "b");
+    REQUIRE(copy.pop(v));  REQUIRE(v == "b");
+    REQUIRE(copy.pop(v));  REQUIRE(v == "c");
+    REQUIRE(copy.pop(v));  REQUIRE(v == "d");
+}
+
+// 17) Zero-copy producer/consumer spans
+TEST_CASE("reserve/commit and peek_spans/consume work in place", "[RingBuffer][Spans]") {
+    RingBuffer<int, 5> rb;
+    int out[5] = {};
+
+    // Move the head to slot 3 so the next region wraps.
+    REQUIRE(rb.push_bulk(out, 3) == 3);
+    rb.consume(3);
+    REQUIRE(rb.empty());
+
+    auto w = rb.reserve(10);
+    REQUIRE(w.size() == 5);
+    REQUIRE(w.first.size == 2);
+    REQUIRE(w.second.size == 3);
+    for (size_t i = 0; i < w.first.size; ++i)  w.first.data[i]  = int(i);
+    for (size_t i = 0; i < w.second.size; ++i) w.second.data[i] = int(w.first.size + i);
+    REQUIRE(rb.empty());  // nothing visible before commit
+    rb.commit(4);
+    REQUIRE(rb.size() == 4);
+
+    auto r = rb.peek_spans();
+    REQUIRE(r.size() == 4);
+    REQUIRE(r.first.size == 2);
+    REQUIRE(r.first.data[0] == 0);
+    REQUIRE(r.second.data[1] == 3);
+
+    rb.consume(3);
+    int v;
+    REQUIRE(rb.pop(v)); REQUIRE(v == 3);
+    REQUIRE(rb.peek_spans().size() == 0);
+}
+
+// 18) consume() destroys non-trivial elements
+TEST_CASE("consume destroys released elements", "[RingBuffer][Spans]") {
+    Tracked::live = 0;
+    RingBuffer<Tracked, 3> rb;
+    rb.emplace(1);
+    rb.emplace(2);
+    auto r = rb.peek_spans();
+    REQUIRE(r.first.data[1].value == 2);
+    rb.consume(5);
+    REQUIRE(rb.empty());
+    REQUIRE(Tracked::live == 0);
+}
+
+// 19) Overwrite-oldest pushes
+TEST_CASE("push_overwrite keeps the newest N elements", "[RingBuffer][Overwrite]") {
+    RingBuffer<int, 3> rb;
+    REQUIRE_FALSE(rb.push_overwrite(1));
+    REQUIRE_FALSE(rb.push_overwrite(2));
+    REQUIRE_FALSE(rb.push_overwrite(3));
+    REQUIRE(rb.push_overwrite(4));
+    REQUIRE(rb.push_overwrite(5));
+    REQUIRE(rb.full());
+
+    int v;
+    REQUIRE(rb.pop(v)); REQUIRE(v == 3);
+    REQUIRE(rb.pop(v)); REQUIRE(v == 4);
+    REQUIRE(rb.pop(v)); REQUIRE(v == 5);
+    REQUIRE(rb.empty());
+}
+
+// 20) Runtime-capacity view over caller storage shares the RingBuffer algorithms
+TEST_CASE("RingBufferView over caller storage", "[RingBuffer][View]") {
+    using antBuffers::RingBufferView;
+    REQUIRE(RingBufferView<std::string>::storageBytes(5) == 8 * sizeof(std::string));
+
+    alignas(std::string) unsigned char raw[RingBufferView<std::string>::storageBytes(5)];
+    {
+        RingBufferView<std::string> rv(raw, 8);
+        REQUIRE(rv.capacity() == 8);
+        REQUIRE(rv.empty());
+
+        std::string v;
+        for (int round = 0; round < 5; ++round) {
+            for (int i = 0; i < 6; ++i) REQUIRE(rv.push(std::to_string(round * 6 + i)));
+            for (int i = 0; i < 6; ++i) {
+                REQUIRE(rv.pop(v));
+                REQUIRE(v == std::to_string(round * 6 + i));
+            }
+        }
+        // Policies work through the view too.
+        for (int i = 0; i < 8; ++i) REQUIRE(rv.push(std::to_string(i)));
+        REQUIRE(rv.push_overwrite("x"));
+        REQUIRE(rv.pop(v));
+        REQUIRE(v == "1");
+    }
+
+    RingBufferView<int> none(nullptr, 0);
+    REQUIRE(none.capacity() == 0);
+    REQUIRE_FALSE(none.push(1));
+    // Full and empty at once: there is no oldest slot to overwrite.
+    REQUIRE_FALSE(none.push_overwrite(2));
+    REQUIRE(none.size() == 0);
+    REQUIRE(none.empty());
+    int v;
+    REQUIRE_FALSE(none.pop(v));
+}
+
+// 21) Opt-in stats policy
+TEST_CASE("RingStats tracks pushes, pops, rejections and high water", "[RingBuffer][Stats]") {
+    static_assert(sizeof(RingBuffer<uint32_t, 4>) == sizeof(RingBuffer<uint32_t, 4, antBuffers::NoRingStats>),
+                  "default policy adds nothing");
+    RingBuffer<uint32_t, 4, antBuffers::RingStats<5>> rb;
+    uint32_t v;
+    REQUIRE_FALSE(rb.pop(v));
+    for (uint32_t i = 0; i < 5; ++i) rb.push(i);   // last one rejected
+    REQUIRE(rb.pop(v));
+    const uint32_t src[3] = {7, 8, 9};
+    REQUIRE(rb.push_bulk(src, 3) == 1);             // two rejected
+    uint32_t dst[4];
+    REQUIRE(rb.pop_bulk(dst, 4) == 4);
+    REQUIRE(rb.pop_bulk(dst, 4) == 0);
+
+    const auto s = rb.stats().snapshot();
+    REQUIRE(s.pushes == 5);
+    REQUIRE(s.pops == 5);
+    REQUIRE(s.rejectedPushes == 3);
+    REQUIRE(s.failedPops == 2);
+    REQUIRE(s.highWater == 4);
+    // One sample per push call, bucketed by occupancy 1..4 over 5 buckets.
+    REQUIRE(s.histogram[1] == 1);
+    REQUIRE(s.histogram[2] == 1);
+    REQUIRE(s.histogram[3] == 1);
+    REQUIRE(s.histogram[4] == 2);
+
+    rb.stats().reset();
+    REQUIRE(rb.stats().snapshot().pushes == 0);
+    REQUIRE(rb.stats().snapshot().highWater == 0);
+}
+
+// 22) Residency timing with a parallel stamp array
+namespace {
+struct FakeClock {
+    static uint64_t t;
+    static uint64_t now() { return t; }
+};
+uint64_t FakeClock::t = 0;
+}
+
+TEST_CASE("ResidencyStats records time between push and pop", "[RingBuffer][Residency]") {
+    using Stats = antBuffers::ResidencyStats<4, antBuffers::RingStats<>, FakeClock>;
+    RingBuffer<uint32_t, 4, Stats> rb;
+    FakeClock::t = 100;
+    rb.push(1);
+    FakeClock::t = 110;
+    const uint32_t src[2] = {2, 3};
+    rb.push_bulk(src, 2);
+    FakeClock::t = 150;
+    uint32_t v;
+    REQUIRE(rb.pop(v));                 // waited 50
+    FakeClock::t = 1110;
+    uint32_t dst[2];
+    REQUIRE(rb.pop_bulk(dst, 2) == 2);  // both waited 1000
+
+    const auto &h = rb.stats().residency();
+    REQUIRE(h.count() == 3);
+    REQUIRE(h.max() == 1000);
+    REQUIRE(h.percentile(30) >= 50);
+    REQUIRE(h.percentile(30) <= 53);
+    REQUIRE(h.percentile(99) == 1000);
+    REQUIRE(rb.stats().snapshot().pops == 3);  // inner counters still work
+}
+
+// 23) Residency stamps are indexed by slot, so the policy must be sized to the ring
+TEST_CASE("ResidencyStats must match the ring capacity", "[RingBuffer][Residency]") {
+    // RingBuffer, SpscRingBuffer and RingBufferView static_assert on these.
+    STATIC_REQUIRE(antBuffers::statsFitCapacity<antBuffers::ResidencyStats<4>>(4));
+    STATIC_REQUIRE_FALSE(antBuffers::statsFitCapacity<antBuffers::ResidencyStats<4>>(8));
+    STATIC_REQUIRE(antBuffers::statsFitCapacity<antBuffers::RingStats<>>(8));
+    STATIC_REQUIRE(antBuffers::ResidencyStats<4, antBuffers::RingStats<>>::timesSlots);  // rejected by RingBufferView
+}
+
+// 24) Overwrite drops are counted by the stats policy, not the ring
+TEST_CASE("push_overwrite reports drops to RingStats", "[RingBuffer][Stats][Overwrite]") {
+    RingBuffer<int, 3, antBuffers::RingStats<>> rb;
+    for (int i = 1; i <= 5; ++i) rb.push_overwrite(i);
+    int v;
+    REQUIRE(rb.pop(v)); REQUIRE(v == 3);
+
+    const auto s = rb.stats().snapshot();
+    REQUIRE(s.dropped == 2);
+    REQUIRE(s.pushes == 5);
+    REQUIRE(s.rejectedPushes == 0);
+    rb.stats().reset();
+    REQUIRE(rb.stats().snapshot().dropped == 0);
+}
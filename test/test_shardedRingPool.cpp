@@ -0,0 +1,174 @@
+#define CATCH_CONFIG_MAIN
+#include <catch.hpp>
+#include "sharded_ring_pool.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <thread>
+#include <vector>
+
+using antBuffers::MpmcRingBuffer;
+using antBuffers::ShardedRingPool;
+
+// 1) Shard count is clamped
+TEST_CASE("shard count is clamped to [1, MaxShards]", "[ShardedRingPool][State]") {
+    ShardedRingPool<int, 4, 8> a(0);
+    ShardedRingPool<int, 4, 8> b(100);
+    ShardedRingPool<int, 4, 8> c(3);
+    REQUIRE(a.shards() == 1);
+    REQUIRE(b.shards() == 8);
+    REQUIRE(c.shards() == 3);
+    REQUIRE(c.shardCapacity() == 4);
+    REQUIRE(c.empty());
+    REQUIRE(c.localShard() < c.shards());
+}
+
+// 2) Workers pop their own shard first, in FIFO order
+TEST_CASE("pop() prefers the worker's own shard", "[ShardedRingPool][PushPop]") {
+    ShardedRingPool<int, 8, 4> pool(4);
+    REQUIRE(pool.push(0, 1));
+    REQUIRE(pool.push(1, 10));
+    REQUIRE(pool.push(0, 2));
+    REQUIRE(pool.size() == 3);
+
+    int v;
+    REQUIRE(pool.pop(0, v)); REQUIRE(v == 1);
+    REQUIRE(pool.pop(0, v)); REQUIRE(v == 2);
+    REQUIRE(pool.ring(1).size() == 1);  // untouched until 0 runs dry
+    REQUIRE(pool.pop(0, v)); REQUIRE(v == 10);
+    REQUIRE_FALSE(pool.pop(0, v));
+}
+
+// 3) Stealing takes half of the nearest busy shard
+TEST_CASE("steal() takes at most half from the nearest non-empty shard", "[ShardedRingPool][Steal]") {
+    ShardedRingPool<int, 16, 4> pool(4);
+    for (int i = 0; i < 8; ++i) REQUIRE(pool.push(3, 30 + i));
+    for (int i = 0; i < 4; ++i) REQUIRE(pool.push(2, 20 + i));
+
+    int batch[16];
+    const size_t n = pool.pop_bulk(1, batch, 16);
+    REQUIRE(n == 2);                     // half of shard 2, the closer one
+    REQUIRE(batch[0] == 20);
+    REQUIRE(batch[1] == 21);
+    REQUIRE(pool.ring(2).size() == 2);
+    REQUIRE(pool.ring(3).size() == 8);
+
+    REQUIRE(pool.steal(1, batch, 1) == 1);  // capped by max
+    REQUIRE(batch[0] == 22);
+
+    // Own shard is drained without stealing when it has work.
+    REQUIRE(pool.push(1, 11));
+    REQUIRE(pool.pop_bulk(1, batch, 16) == 1);
+    REQUIRE(batch[0] == 11);
+}
+
+// 4) Every element is consumed exactly once under concurrency
+TEST_CASE("concurrent workers consume every element exactly once", "[ShardedRingPool][Threads]") {
+    constexpr size_t WORKERS = 4;
+    constexpr uint64_t PER_WORKER = 20000;
+    auto pool = std::make_unique<ShardedRingPool<uint64_t, 256, WORKERS>>(WORKERS);
+    std::atomic<uint64_t> sum{0}, count{0};
+
+    std::vector<std::thread> threads;
+    for (size_t w = 0; w < WORKERS; ++w) {
+        threads.emplace_back([&, w] {
+            uint64_t local = 0, popped = 0;
+            uint64_t batch[32];
+            // Only worker 0 produces, so the others live off stealing.
+            for (uint64_t i = 1; w == 0 && i <= PER_WORKER * WORKERS; ++i) {
+                while (!pool->push(0, i)) {
+                    const size_t n = pool->pop_bulk(0, batch, 32);
+                    for (size_t k = 0; k < n; ++k) local += batch[k];
+                    popped += n;
+                }
+            }
+            for (;;) {
+                const size_t n = pool->pop_bulk(w, batch, 32);
+                for (size_t k = 0; k < n; ++k) local += batch[k];
+                popped += n;
+                if (n == 0) {
+                    if (count.load() + popped == PER_WORKER * WORKERS) break;
+                    std::this_thread::yield();
+                    // Publish progress so the exit check can converge.
+                    count += popped;
+                    sum += local;
+                    popped = local = 0;
+                }
+            }
+            count += popped;
+            sum += local;
+        });
+    }
+    for (auto &t : threads) t.join();
+
+    const uint64_t total = PER_WORKER * WORKERS;
+    REQUIRE(count.load() == total);
+    REQUIRE(sum.load() == total * (total + 1) / 2);
+    REQUIRE(pool->empty());
+}
+
+// 5) Scaling vs. a single shared ring (hidden; run with: test_shardedRingPool "[benchmark]")
+TEST_CASE("sharded pool scales with threads", "[.][benchmark][ShardedRingPool]") {
+    constexpr uint64_t OPS_PER_THREAD = 200000;
+    constexpr size_t MAX_THREADS = 64;
+    const size_t cpus = std::max(1u, std::thread::hardware_concurrency());
+
+    // Each thread pushes into and pops from the queue in bursts of 16; total
+    // work grows with the thread count, so flat ops/s means no scaling.
+    auto run = [&](size_t threads, auto pushFn, auto popFn) {
+        std::atomic<bool> go{false};
+        std::vector<std::thread> ts;
+        for (size_t t = 0; t < threads; ++t) {
+            ts.emplace_back([&, t] {
+                antBuffers::pinCurrentThread(t % cpus);
+                while (!go.load(std::memory_order_acquire)) std::this_thread::yield();
+                uint64_t v;
+                for (uint64_t i = 0; i < OPS_PER_THREAD; i += 16) {
+                    for (uint64_t k = 0; k < 16; ++k) pushFn(t, i + k);
+                    for (uint64_t k = 0; k < 16; ++k) popFn(t, v);
+                }
+            });
+        }
+        const auto start = std::chrono::steady_clock::now();
+        go.store(true, std::memory_order_release);
+        for (auto &th : ts) th.join();
+        const double secs = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        return double(OPS_PER_THREAD * threads) / secs;
+    };
+
+    for (size_t threads = 1; threads <= MAX_THREADS; threads *= 2) {
+        auto pool = std::make_unique<ShardedRingPool<uint64_t, 1024, MAX_THREADS>>(threads);
+        const double sharded = run(threads,
+            [&](size_t t, uint64_t v) { pool->push(t, v); },
+            [&](size_t t, uint64_t &v) { pool->pop(t, v); });
+
+        auto shared = std::make_unique<MpmcRingBuffer<uint64_t, 1024>>();
+        const double single = run(threads,
+            [&](size_t, uint64_t v) { shared->push(v); },
+            [&](size_t, uint64_t &v) { shared->pop(v); });
+
+        WARN(threads << " threads: sharded " << uint64_t(sharded) << " ops/s, shared ring "
+             << uint64_t(single) << " ops/s");
+    }
+}
+
+// 6) pop() steals a batch and keeps the remainder in its own shard
+TEST_CASE("pop() moves the rest of a stolen batch into the thief's shard", "[ShardedRingPool][Steal]") {
+    ShardedRingPool<int, 16, 4> pool(4);
+    for (int i = 0; i < 8; ++i) REQUIRE(pool.push(2, 20 + i));
+
+    int v;
+    REQUIRE(pool.pop(1, v));
+    REQUIRE(v == 20);
+    REQUIRE(pool.ring(2).size() == 4);  // half stolen in one go
+    REQUIRE(pool.ring(1).size() == 3);  // the rest now local to the thief
+
+    // Later pops are served from the thief's own shard, in order.
+    for (int i = 21; i < 24; ++i) {
+        REQUIRE(pool.pop(1, v));
+        REQUIRE(v == i);
+    }
+    REQUIRE(pool.ring(2).size() == 4);
+}
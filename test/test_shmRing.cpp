@@ -0,0 +1,161 @@
+#define CATCH_CONFIG_MAIN
+#include <catch.hpp>
+#include "shm_ring.h"
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#if defined(__unix__) || defined(__APPLE__)
+using antBuffers::ShmRecordRing;
+using antBuffers::ShmRing;
+
+namespace {
+/** @brief Per-process unique region name, removed again on scope exit. */
+struct ScopedName {
+    std::string name;
+    explicit ScopedName(const char *tag)
+        : name(std::string("/antBuffers-test-") + tag + "-" + std::to_string(::getpid())) {
+        ::shm_unlink(name.c_str());
+    }
+    ~ScopedName() { ::shm_unlink(name.c_str()); }
+    const char *c_str() const { return name.c_str(); }
+};
+
+/** @brief Element with more than one word, so torn copies would show. */
+struct Sample {
+    uint64_t seq;
+    uint64_t check;
+};
+
+/**
+ * @brief Fork a consumer process that attaches to @p name and pops @p count
+ *        Samples, exiting 0 if they arrive in order and intact.
+ */
+pid_t forkSampleConsumer(const char *name, uint64_t count) {
+    const pid_t pid = ::fork();
+    if (pid != 0) return pid;
+    auto ring = ShmRing<Sample>::attach(name);
+    if (!ring.valid()) ::_exit(2);
+    for (uint64_t i = 0; i < count; ++i) {
+        Sample s;
+        while (!ring.pop(s)) {}
+        if (s.seq != i || s.check != ~i) ::_exit(1);
+    }
+    ::_exit(0);
+}
+
+int waitExit(pid_t pid) {
+    int status = 0;
+    ::waitpid(pid, &status, 0);
+    return WIFEXITED(status) ? WEXITSTATUS(status) : -1;
+}
+} // namespace
+
+// 1) Create, attach and layout validation
+TEST_CASE("create and attach share one region", "[ShmRing][Attach]") {
+    ScopedName name("attach");
+    auto producer = ShmRing<uint32_t>::create(name.c_str(), 5);
+    REQUIRE(producer.valid());
+    REQUIRE(producer.capacity() == 8);
+
+    auto consumer = ShmRing<uint32_t>::attach(name.c_str());
+    REQUIRE(consumer.valid());
+    REQUIRE(consumer.capacity() == 8);
+
+    for (uint32_t i = 0; i < 8; ++i) REQUIRE(producer.push(i));
+    REQUIRE_FALSE(producer.push(8));
+    REQUIRE(consumer.full());
+    uint32_t v;
+    for (uint32_t i = 0; i < 8; ++i) {
+        REQUIRE(consumer.pop(v));
+        REQUIRE(v == i);
+    }
+    REQUIRE_FALSE(consumer.pop(v));
+
+    // Wrong element size, duplicate create and missing regions are rejected.
+    REQUIRE_FALSE(ShmRing<uint64_t>::attach(name.c_str()).valid());
+    REQUIRE_FALSE(ShmRecordRing::attach(name.c_str()).valid());
+    REQUIRE_FALSE(ShmRing<uint32_t>::create(name.c_str(), 8).valid());
+    REQUIRE_FALSE(ShmRing<uint32_t>::attach("/antBuffers-test-missing").valid());
+    if (sizeof(size_t) == 8) {
+        // capacity * sizeof(T) wraps to 0; must fail rather than map a tiny region.
+        ScopedName huge("huge");
+        REQUIRE_FALSE(ShmRing<uint32_t>::create(huge.c_str(), size_t(uint64_t(1) << 62)).valid());
+    }
+
+    // A ring whose attach failed refuses every operation instead of crashing.
+    auto failed = ShmRing<uint32_t>::attach("/antBuffers-test-missing");
+    REQUIRE_FALSE(failed.push(1));
+    REQUIRE_FALSE(failed.pop(v));
+    REQUIRE(failed.size() == 0);
+    REQUIRE(failed.capacity() == 0);
+    REQUIRE(failed.empty());
+}
+
+// 2) Two processes
+TEST_CASE("elements cross a process boundary in order", "[ShmRing][Process]") {
+    constexpr uint64_t COUNT = 100000;
+    ScopedName name("proc");
+    auto ring = ShmRing<Sample>::create(name.c_str(), 64);
+    REQUIRE(ring.valid());
+
+    const pid_t child = forkSampleConsumer(name.c_str(), COUNT);
+    for (uint64_t i = 0; i < COUNT; ++i) {
+        while (!ring.push(Sample{i, ~i})) {}
+    }
+    REQUIRE(waitExit(child) == 0);
+    REQUIRE(ring.empty());
+}
+
+// 3) Variable-length records, including ones that need a skip marker at the wrap
+TEST_CASE("record ring wraps records without splitting them", "[ShmRecordRing][Wrap]") {
+    ScopedName name("records");
+    auto producer = ShmRecordRing::create(name.c_str(), 64);
+    auto consumer = ShmRecordRing::attach(name.c_str());
+    REQUIRE(producer.valid());
+    REQUIRE(consumer.valid());
+    REQUIRE(producer.capacity() == 64);
+    REQUIRE(ShmRecordRing::maxRecordFor(64) == 28);
+
+    uint8_t payload[32];
+    for (uint8_t i = 0; i < sizeof(payload); ++i) payload[i] = i;
+    REQUIRE_FALSE(producer.push(payload, 29));
+
+    uint8_t out[32];
+    size_t len;
+    for (size_t round = 0; round < 50; ++round) {
+        const size_t n = 1 + (round * 7) % 28;
+        REQUIRE(producer.push(payload, n));
+        const uint8_t *p;
+        REQUIRE(consumer.peek(p, len));
+        REQUIRE(len == n);
+        REQUIRE(p[n - 1] == uint8_t(n - 1));  // contiguous in place
+        consumer.consume();
+
+        REQUIRE(producer.push(payload + 1, n - 1));
+        REQUIRE(consumer.pop(out, sizeof(out), len));
+        REQUIRE(len == n - 1);
+        if (len) REQUIRE(out[0] == 1);
+    }
+    REQUIRE_FALSE(consumer.pop(out, sizeof(out), len));
+}
+
+// 4) Two-process throughput (hidden; run with: test_shmRing "[benchmark]")
+TEST_CASE("two-process throughput", "[.][benchmark][ShmRing]") {
+    constexpr uint64_t COUNT = 20000000;
+    ScopedName name("bench");
+    auto ring = ShmRing<Sample>::create(name.c_str(), 4096);
+    REQUIRE(ring.valid());
+
+    const auto start = std::chrono::steady_clock::now();
+    const pid_t child = forkSampleConsumer(name.c_str(), COUNT);
+    for (uint64_t i = 0; i < COUNT; ++i) {
+        while (!ring.push(Sample{i, ~i})) {}
+    }
+    REQUIRE(waitExit(child) == 0);
+    const std::chrono::duration<double> secs = std::chrono::steady_clock::now() - start;
+    WARN("ShmRing<16-byte>: " << uint64_t(double(COUNT) / secs.count()) << " ops/s across processes");
+}
+#endif
@@ -0,0 +1,162 @@
+#define CATCH_CONFIG_MAIN
+#include <catch.hpp>
+#include "spsc_ring_buffer.h"
+#include <string>
+#include <thread>
+#include <atomic>
+#include <cstdint>
+
+using antBuffers::SpscRingBuffer;
+
+// 1) Capacity and initial state
+TEST_CASE("capacity() and initial state", "[SpscRingBuffer][State]") {
+    SpscRingBuffer<int, 5> rb;
+    REQUIRE(rb.capacity() == 5);
+    REQUIRE(rb.empty());
+    REQUIRE_FALSE(rb.full());
+    REQUIRE(rb.size() == 0);
+}
+
+// 2) Push until full, pop until empty
+TEST_CASE("push succeeds until full and pop until empty", "[SpscRingBuffer][PushPop]") {
+    SpscRingBuffer<int, 3> rb;
+    REQUIRE(rb.push(1));
+    REQUIRE(rb.push(2));
+    REQUIRE(rb.push(3));
+    REQUIRE(rb.full());
+    REQUIRE_FALSE(rb.push(4));
+
+    int v;
+    REQUIRE(rb.pop(v)); REQUIRE(v == 1);
+    REQUIRE(rb.pop(v)); REQUIRE(v == 2);
+    REQUIRE(rb.pop(v)); REQUIRE(v == 3);
+    REQUIRE_FALSE(rb.pop(v));
+    REQUIRE(rb.empty());
+}
+
+// 3) Move-push semantics
+TEST_CASE("push(T&&) uses move semantics", "[SpscRingBuffer][Move]") {
+    SpscRingBuffer<std::string, 2> rb;
+    std::string foo = "foo";
+    REQUIRE(rb.push(std::move(foo)));
+    std::string popped;
+    REQUIRE(rb.pop(popped));
+    REQUIRE(popped == "foo");
+    REQUIRE(foo.empty());
+}
+
+// 4) Wrap-around, for both the masked and the general counter arithmetic
+TEMPLATE_TEST_CASE_SIG("counters wrap around correctly", "[SpscRingBuffer][Wrap]",
+                       ((size_t N), N), (3), (4)) {
+    SpscRingBuffer<int, N> rb;
+    int next = 0;
+    int expected = 0;
+    for (int round = 0; round < 50; ++round) {
+        while (rb.push(next)) ++next;
+        REQUIRE(rb.size() == N);
+        int v;
+        REQUIRE(rb.pop(v)); REQUIRE(v == expected++);
+        REQUIRE(rb.pop(v)); REQUIRE(v == expected++);
+        REQUIRE(rb.size() == N - 2);
+    }
+}
+
+// 5) One producer thread, one consumer thread, FIFO order preserved
+TEST_CASE("producer and consumer threads preserve order", "[SpscRingBuffer][Threads]") {
+    constexpr uint32_t COUNT = 200000;
+    SpscRingBuffer<uint32_t, 64> rb;
+
+    std::thread producer([&] {
+        for (uint32_t i = 0; i < COUNT; ++i) {
+            while (!rb.push(i)) std::this_thread::yield();
+        }
+    });
+
+    uint32_t expected = 0;
+    bool inOrder = true;
+    while (expected < COUNT) {
+        uint32_t v;
+        if (!rb.pop(v)) { std::this_thread::yield(); continue; }
+        inOrder = inOrder && (v == expected);
+        ++expected;
+    }
+    producer.join();
+
+    REQUIRE(inOrder);
+    REQUIRE(rb.empty());
+}
+
+// 6) Overwrite policy, single-threaded
+TEST_CASE("push_overwrite keeps the newest N elements", "[SpscRingBuffer][Overwrite]") {
+    SpscRingBuffer<int, 3, antBuffers::OverflowPolicy::Overwrite, antBuffers::RingStats<>> rb;
+    int drops = 0;
+    for (int i = 1; i <= 5; ++i) drops += rb.push_overwrite(i);
+    REQUIRE(drops == 2);
+    REQUIRE(rb.stats().snapshot().dropped == 2);
+    REQUIRE(rb.full());
+
+    int v;
+    REQUIRE(rb.pop(v)); REQUIRE(v == 3);
+    REQUIRE(rb.pop(v)); REQUIRE(v == 4);
+    REQUIRE(rb.pop(v)); REQUIRE(v == 5);
+    REQUIRE_FALSE(rb.pop(v));
+}
+
+// 7) Overwrite policy with a racing consumer: no duplicates, no reordering, nothing lost uncounted.
+//    The non-power-of-two size used to wrap its counters at 2N, letting a stale tail CAS succeed.
+TEMPLATE_TEST_CASE_SIG("push_overwrite with a concurrent consumer", "[SpscRingBuffer][Overwrite][Threads]",
+                       ((size_t N), N), (8), (3), (5)) {
+    constexpr uint64_t COUNT = 200000;
+    SpscRingBuffer<uint64_t, N, antBuffers::OverflowPolicy::Overwrite, antBuffers::RingStats<>> rb;
+    std::atomic<bool> done{false};
+
+    std::thread producer([&] {
+        // Payload repeats the value in both halves so a torn read would show.
+        for (uint64_t i = 1; i <= COUNT; ++i) rb.push_overwrite((i << 32) | i);
+        done.store(true, std::memory_order_release);
+    });
+
+    uint64_t popped = 0;
+    uint64_t last = 0;
+    bool ok = true;
+    for (;;) {
+        uint64_t v;
+        if (rb.pop(v)) {
+            const uint64_t i = v >> 32;
+            ok = ok && (i == (v & 0xFFFFFFFFu)) && (i > last);
+            last = i;
+            ++popped;
+        } else if (done.load(std::memory_order_acquire)) {
+            if (rb.empty()) break;
+        }
+    }
+    producer.join();
+
+    REQUIRE(ok);
+    REQUIRE(last == COUNT);
+    REQUIRE(popped + rb.stats().snapshot().dropped == COUNT);
+}
+
+// 8) Opt-in stats policy, read while the ring is in use
+TEST_CASE("RingStats counts both sides of an SPSC ring", "[SpscRingBuffer][Stats]") {
+    constexpr uint64_t COUNT = 100000;
+    SpscRingBuffer<uint64_t, 64, antBuffers::OverflowPolicy::Reject, antBuffers::RingStats<>> rb;
+
+    std::thread producer([&] {
+        for (uint64_t i = 0; i < COUNT; ++i) {
+            while (!rb.push(i)) std::this_thread::yield();
+        }
+    });
+    uint64_t popped = 0, v;
+    while (popped < COUNT) {
+        if (rb.pop(v)) ++popped;
+        (void)rb.stats().snapshot();  // exporter thread stand-in
+    }
+    producer.join();
+
+    const auto s = rb.stats().snapshot();
+    REQUIRE(s.pushes == COUNT);
+    REQUIRE(s.pops == COUNT);
+    REQUIRE(s.highWater >= 1);
+    REQUIRE(s.highWater <= 64);
+}
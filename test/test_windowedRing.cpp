@@ -0,0 +1,111 @@
+#define CATCH_CONFIG_MAIN
+#include <catch.hpp>
+#include "windowed_ring.h"
+#include <algorithm>
+#include <cstdint>
+#include <deque>
+#include <random>
+
+using antBuffers::WindowedRing;
+
+namespace {
+// Brute-force reference over the same window.
+struct Reference {
+    std::deque<double> w;
+    double min() const { return *std::min_element(w.begin(), w.end()); }
+    double max() const { return *std::max_element(w.begin(), w.end()); }
+    double mean() const {
+        double s = 0;
+        for (double x : w) s += x;
+        return s / double(w.size());
+    }
+    double variance() const {
+        const double m = mean();
+        double s = 0;
+        for (double x : w) s += (x - m) * (x - m);
+        return s / double(w.size());
+    }
+};
+}
+
+// 1) Initial state and filling
+TEST_CASE("aggregates while the window fills", "[WindowedRing][Fill]") {
+    WindowedRing<int, 4> w;
+    REQUIRE(w.empty());
+    REQUIRE(w.capacity() == 4);
+    REQUIRE(w.mean() == 0);
+    REQUIRE(w.variance() == 0);
+
+    REQUIRE_FALSE(w.push(2));
+    REQUIRE_FALSE(w.push(4));
+    REQUIRE_FALSE(w.push(4));
+    REQUIRE_FALSE(w.push(6));
+    REQUIRE(w.full());
+    REQUIRE(w.min() == 2);
+    REQUIRE(w.max() == 6);
+    REQUIRE(w.mean() == Approx(4.0));
+    REQUIRE(w.variance() == Approx(2.0));
+    REQUIRE(w.sampleVariance() == Approx(8.0 / 3.0));
+    REQUIRE(w.oldest() == 2);
+    REQUIRE(w.newest() == 6);
+}
+
+// 2) Sliding evicts the oldest sample and its extremes
+TEST_CASE("push() on a full window slides it", "[WindowedRing][Slide]") {
+    WindowedRing<int, 3> w;
+    w.push(1); w.push(9); w.push(5);
+    REQUIRE(w.push(3));            // evicts 1
+    REQUIRE(w.min() == 3);
+    REQUIRE(w.max() == 9);
+    REQUIRE(w.push(4));            // evicts 9
+    REQUIRE(w.max() == 5);
+    REQUIRE(w.mean() == Approx(4.0));
+    REQUIRE(w.oldest() == 5);
+}
+
+// 3) Explicit eviction for time-based windows
+TEST_CASE("evictOldest() shrinks the window down to empty", "[WindowedRing][Evict]") {
+    WindowedRing<double, 4> w;
+    w.push(1.0); w.push(3.0); w.push(5.0);
+    REQUIRE(w.evictOldest());
+    REQUIRE(w.size() == 2);
+    REQUIRE(w.min() == 3.0);
+    REQUIRE(w.mean() == Approx(4.0));
+    REQUIRE(w.variance() == Approx(1.0));
+    REQUIRE(w.evictOldest());
+    REQUIRE(w.evictOldest());
+    REQUIRE_FALSE(w.evictOldest());
+    REQUIRE(w.mean() == 0);
+    REQUIRE(w.variance() == 0);
+
+    w.push(7.0);
+    REQUIRE(w.min() == 7.0);
+    REQUIRE(w.max() == 7.0);
+    w.clear();
+    REQUIRE(w.empty());
+}
+
+// 4) Matches a brute-force rescan over a long random stream
+TEST_CASE("incremental aggregates match a full rescan", "[WindowedRing][Reference]") {
+    constexpr size_t N = 37;
+    WindowedRing<int32_t, N> w;
+    Reference ref;
+    std::mt19937 rng(42);
+    std::uniform_int_distribution<int32_t> dist(-1000, 1000);
+
+    for (int i = 0; i < 20000; ++i) {
+        const int32_t v = dist(rng);
+        w.push(v);
+        ref.w.push_back(v);
+        if (ref.w.size() > N) ref.w.pop_front();
+        if (i % 7 == 3 && w.size() > 1) {  // mix in time-window style evictions
+            w.evictOldest();
+            ref.w.pop_front();
+        }
+        REQUIRE(w.size() == ref.w.size());
+        REQUIRE(double(w.min()) == ref.min());
+        REQUIRE(double(w.max()) == ref.max());
+        REQUIRE(w.mean() == Approx(ref.mean()).margin(1e-6));
+        REQUIRE(w.variance() == Approx(ref.variance()).epsilon(1e-6).margin(1e-6));
+    }
+}